@@ -1,15 +1,18 @@
 #ifndef S21_CONTAINERS_S21_ARRAY_ARRAY_H_
 #define S21_CONTAINERS_S21_ARRAY_ARRAY_H_
 
-#include <climits>
-#include <cstring>
-#include <initializer_list>
+#include <cstddef>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
+// Fixed-size array with inline storage. It is an aggregate, like a C array
+// wrapped in a struct: brace initialization fills the elements in order,
+// copy and move are the implicit element-wise ones and the whole type is
+// usable in constant expressions.
 template <typename T, size_t Nm>
-class array {
- public:
+struct array {
   // array member type
   using value_type = T;
   using reference = T &;
@@ -18,74 +21,54 @@ class array {
   using const_iterator = const T *;
   using size_type = size_t;
 
-  // array member functions
-  array() noexcept : start(new value_type[Nm]), len(Nm) {}
-  array(std::initializer_list<value_type> const &items) : array() {
-    copy_contents(start, items.begin(), items.size() > Nm ? Nm : items.size());
+  // array element access
+  constexpr reference at(size_type pos) {
+    if (pos >= Nm) throw std::out_of_range("pos is out of the scope");
+    return data_[pos];
   }
-  array(const array &a) : array() { *this = a; }
-  array(array &&a) noexcept : start(nullptr), len(Nm) { *this = std::move(a); }
-  ~array() noexcept { delete[] start; }
-  array &operator=(const array &a) noexcept {
-    if (this != &a) {
-      copy_contents(start, a.start, len);
-    }
-    return *this;
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= Nm) throw std::out_of_range("pos is out of the scope");
+    return data_[pos];
   }
-  array &operator=(array &&a) noexcept {
-    if (this != &a) {
-      delete[] start;
-      start = a.start;
-      a.start = nullptr;
-      a.len = 0;
-    }
-    return *this;
+  constexpr reference operator[](size_type pos) noexcept { return data_[pos]; }
+  constexpr const_reference operator[](size_type pos) const noexcept {
+    return data_[pos];
   }
-
-  // array element access
-  reference at(size_type pos) const {
-    if (pos >= len) {
-      throw std::out_of_range("pos is out of the scope");
-    } else {
-      return start[pos];
-    }
-  }
-  reference operator[](size_type pos) const noexcept { return start[pos]; }
-  const_reference front() const noexcept { return start[0]; }
-  const_reference back() const noexcept { return start[len - 1]; }
-  iterator data() const noexcept { return start; }
+  constexpr reference front() noexcept { return data_[0]; }
+  constexpr const_reference front() const noexcept { return data_[0]; }
+  constexpr reference back() noexcept { return data_[Nm - 1]; }
+  constexpr const_reference back() const noexcept { return data_[Nm - 1]; }
+  constexpr iterator data() noexcept { return data_; }
+  constexpr const_iterator data() const noexcept { return data_; }
 
   // array iterators
-  iterator begin() const noexcept { return start; }
-  iterator end() const noexcept { return start + len; }
+  constexpr iterator begin() noexcept { return data_; }
+  constexpr const_iterator begin() const noexcept { return data_; }
+  constexpr iterator end() noexcept { return data_ + Nm; }
+  constexpr const_iterator end() const noexcept { return data_ + Nm; }
 
   // array capacity
-  bool empty() const noexcept { return len == 0; }
-  size_type size() const noexcept { return len; }
-  size_type max_size() const noexcept { return Nm; }
+  constexpr bool empty() const noexcept { return Nm == 0; }
+  constexpr size_type size() const noexcept { return Nm; }
+  constexpr size_type max_size() const noexcept { return Nm; }
 
   // array modifiers
-  void swap(array &other) noexcept {
-    iterator tempi = other.start;
-    other.start = start;
-    start = tempi;
-  }
-  void fill(const_reference value) noexcept {
-    for (size_type i = 0; i < len; ++i) {
-      start[i] = value;
+  void swap(array &other) noexcept(
+      std::is_nothrow_swappable<value_type>::value) {
+    for (size_type i = 0; i < Nm; ++i) {
+      using std::swap;
+      swap(data_[i], other.data_[i]);
     }
   }
-
- private:
-  iterator start;
-  size_type len;
-
-  void copy_contents(iterator dest, const_iterator src,
-                     size_type count) noexcept {
-    for (size_type i = 0; i < count; ++i) {
-      dest[i] = src[i];
+  constexpr void fill(const_reference value) {
+    for (size_type i = 0; i < Nm; ++i) {
+      data_[i] = value;
     }
   }
+
+  // public so that the type stays an aggregate; a zero-sized array keeps
+  // one unused slot because C++ has no zero-length arrays
+  value_type data_[Nm == 0 ? 1 : Nm];
 };
 }  // namespace s21
 
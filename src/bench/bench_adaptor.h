@@ -0,0 +1,71 @@
+#ifndef S21_CONTAINERS_BENCH_ADAPTOR_H_
+#define S21_CONTAINERS_BENCH_ADAPTOR_H_
+
+#include "bench_main.h"
+
+// Benchmarks shared by stack and queue, with the size as range(0).
+namespace bench::adaptor {
+template <typename C>
+void Fill(C &c, const std::vector<int> &values) {
+  for (int value : values) c.push(value);
+}
+
+template <typename C>
+void BM_Push(benchmark::State &state) {
+  std::vector<int> values = MakeKeys(state.range(0), kUniform);
+  for (auto _ : state) {
+    C c;
+    Fill(c, values);
+    benchmark::DoNotOptimize(c);
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void BM_Pop(benchmark::State &state) {
+  std::vector<int> values = MakeKeys(state.range(0), kUniform);
+  for (auto _ : state) {
+    state.PauseTiming();
+    C c;
+    Fill(c, values);
+    state.ResumeTiming();
+    while (!c.empty()) c.pop();
+    benchmark::DoNotOptimize(c);
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void BM_Copy(benchmark::State &state) {
+  C c;
+  Fill(c, MakeKeys(state.range(0), kUniform));
+  for (auto _ : state) {
+    C copy(c);
+    benchmark::DoNotOptimize(copy);
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void BM_Move(benchmark::State &state) {
+  C c;
+  Fill(c, MakeKeys(state.range(0), kUniform));
+  for (auto _ : state) {
+    C moved(std::move(c));
+    c = std::move(moved);
+    benchmark::DoNotOptimize(c);
+  }
+}
+
+// Registers every benchmark above for C under "<benchmark>/<name>/...".
+template <typename C>
+int RegisterAll(const char *name) {
+  Register("Push", name, BM_Push<C>)->Apply(Sizes);
+  Register("Pop", name, BM_Pop<C>)->Apply(Sizes);
+  Register("Copy", name, BM_Copy<C>)->Apply(Sizes);
+  Register("Move", name, BM_Move<C>)->Apply(Sizes);
+  return 0;
+}
+}  // namespace bench::adaptor
+
+#endif  // S21_CONTAINERS_BENCH_ADAPTOR_H_
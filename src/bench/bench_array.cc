@@ -0,0 +1,97 @@
+#include "bench_main.h"
+
+// The array size is a template argument, so the sizes are listed by hand.
+// Arrays live on the heap to keep the larger ones off the stack.
+namespace {
+template <typename A>
+void BM_ArrayFill(benchmark::State &state) {
+  auto a = std::make_unique<A>();
+  for (auto _ : state) {
+    a->fill(7);
+    benchmark::DoNotOptimize(a->data());
+  }
+  state.SetItemsProcessed(state.iterations() * a->size());
+}
+
+template <typename A>
+void BM_ArrayIterate(benchmark::State &state) {
+  auto a = std::make_unique<A>();
+  a->fill(1);
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = a->begin(); it != a->end(); ++it) sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * a->size());
+}
+
+template <typename A>
+void BM_ArrayCopy(benchmark::State &state) {
+  auto a = std::make_unique<A>();
+  auto b = std::make_unique<A>();
+  a->fill(1);
+  for (auto _ : state) {
+    *b = *a;
+    benchmark::DoNotOptimize(b->data());
+  }
+  state.SetItemsProcessed(state.iterations() * a->size());
+}
+
+template <typename A>
+void BM_ArrayMove(benchmark::State &state) {
+  auto a = std::make_unique<A>();
+  auto b = std::make_unique<A>();
+  a->fill(1);
+  for (auto _ : state) {
+    *b = std::move(*a);
+    *a = std::move(*b);
+    benchmark::DoNotOptimize(a->data());
+  }
+}
+
+// small temporaries are the common case, so construction gets its own
+template <typename A>
+void BM_ArrayTemporary(benchmark::State &state) {
+  for (auto _ : state) {
+    A a{1, 2, 3, 4};
+    benchmark::DoNotOptimize(a);
+  }
+}
+
+using S21Array10 = s21::array<int, 10>;
+using StdArray10 = std::array<int, 10>;
+using S21Array1000 = s21::array<int, 1000>;
+using StdArray1000 = std::array<int, 1000>;
+using S21Array100000 = s21::array<int, 100000>;
+using StdArray100000 = std::array<int, 100000>;
+using S21Array10000000 = s21::array<int, 10000000>;
+using StdArray10000000 = std::array<int, 10000000>;
+using S21Float4 = s21::array<float, 4>;
+using StdFloat4 = std::array<float, 4>;
+
+template <typename A>
+int RegisterArray(const char *name) {
+  bench::Register("ArrayFill", name, BM_ArrayFill<A>);
+  bench::Register("ArrayIterate", name, BM_ArrayIterate<A>);
+  bench::Register("ArrayCopy", name, BM_ArrayCopy<A>);
+  bench::Register("ArrayMove", name, BM_ArrayMove<A>);
+  return 0;
+}
+
+const int kRegistered[] = {
+    RegisterArray<S21Array10>("S21Array10"),
+    RegisterArray<StdArray10>("StdArray10"),
+    RegisterArray<S21Array1000>("S21Array1000"),
+    RegisterArray<StdArray1000>("StdArray1000"),
+    RegisterArray<S21Array100000>("S21Array100000"),
+    RegisterArray<StdArray100000>("StdArray100000"),
+#if S21_BENCH_MAX_SIZE >= 10000000
+    RegisterArray<S21Array10000000>("S21Array10000000"),
+    RegisterArray<StdArray10000000>("StdArray10000000"),
+#endif
+    bench::Register("ArrayTemporary", "S21Float4",
+                    BM_ArrayTemporary<S21Float4>) != nullptr,
+    bench::Register("ArrayTemporary", "StdFloat4",
+                    BM_ArrayTemporary<StdFloat4>) != nullptr,
+};
+}  // namespace
@@ -0,0 +1,156 @@
+#ifndef S21_CONTAINERS_BENCH_ASSOCIATIVE_H_
+#define S21_CONTAINERS_BENCH_ASSOCIATIVE_H_
+
+#include "bench_main.h"
+
+// Benchmarks shared by the keyed containers. Every one takes the container
+// size as range(0) and a bench::Distribution as range(1), and works for the
+// s21 container and its std counterpart alike.
+namespace bench::keyed {
+template <typename C, typename = void>
+struct is_map : std::false_type {};
+template <typename C>
+struct is_map<C, std::void_t<typename C::mapped_type>> : std::true_type {};
+
+template <typename C>
+typename C::value_type MakeValue(int key) {
+  if constexpr (is_map<C>::value) {
+    return typename C::value_type(key, key);
+  } else {
+    return key;
+  }
+}
+
+template <typename C, typename V>
+int KeyOf(const V &value) {
+  if constexpr (is_map<C>::value) {
+    return value.first;
+  } else {
+    return value;
+  }
+}
+
+template <typename C, typename = void>
+struct has_range_insert : std::false_type {};
+template <typename C>
+struct has_range_insert<
+    C, std::void_t<decltype(std::declval<C &>().insert(
+           std::declval<const typename C::value_type *>(),
+           std::declval<const typename C::value_type *>()))>>
+    : std::true_type {};
+
+template <typename C>
+void Fill(C &c, const std::vector<int> &keys) {
+  for (int key : keys) c.insert(MakeValue<C>(key));
+}
+
+// Fill for the setup of benchmarks that only time reads: one batch when C
+// takes a range, so that the sorted-vector containers do not pay a
+// quadratic setup.
+template <typename C>
+void FillForReads(C &c, const std::vector<int> &keys) {
+  if constexpr (has_range_insert<C>::value) {
+    std::vector<typename C::value_type> values;
+    values.reserve(keys.size());
+    for (int key : keys) values.push_back(MakeValue<C>(key));
+    c.insert(values.data(), values.data() + values.size());
+  } else {
+    Fill(c, keys);
+  }
+}
+
+// builds and destroys a container of range(0) keys per iteration
+template <typename C>
+void BM_Insert(benchmark::State &state) {
+  std::vector<int> keys = MakeKeys(state.range(0), state.range(1));
+  for (auto _ : state) {
+    C c;
+    Fill(c, keys);
+    benchmark::DoNotOptimize(c);
+  }
+  SetItems(state);
+}
+
+// looks every key up once; half of the probes miss
+template <typename C>
+void BM_Find(benchmark::State &state) {
+  std::vector<int> keys = MakeKeys(state.range(0), state.range(1));
+  std::vector<int> present;
+  for (size_t i = 0; i < keys.size(); i += 2) present.push_back(keys[i]);
+  C c;
+  FillForReads(c, present);
+  for (auto _ : state) {
+    size_t found = 0;
+    for (int key : keys) found += Contains(c, key);
+    benchmark::DoNotOptimize(found);
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void BM_Erase(benchmark::State &state) {
+  std::vector<int> keys = MakeKeys(state.range(0), state.range(1));
+  for (auto _ : state) {
+    state.PauseTiming();
+    C c;
+    Fill(c, keys);
+    state.ResumeTiming();
+    for (int key : keys) c.erase(key);
+    benchmark::DoNotOptimize(c);
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void BM_Iterate(benchmark::State &state) {
+  C c;
+  FillForReads(c, MakeKeys(state.range(0), state.range(1)));
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = c.begin(); it != c.end(); ++it) sum += KeyOf<C>(*it);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void BM_Copy(benchmark::State &state) {
+  C c;
+  FillForReads(c, MakeKeys(state.range(0), state.range(1)));
+  for (auto _ : state) {
+    C copy(c);
+    benchmark::DoNotOptimize(copy);
+  }
+  SetItems(state);
+}
+
+// moves there and back, so every iteration starts from a full container
+template <typename C>
+void BM_Move(benchmark::State &state) {
+  C c;
+  FillForReads(c, MakeKeys(state.range(0), state.range(1)));
+  for (auto _ : state) {
+    C moved(std::move(c));
+    c = std::move(moved);
+    benchmark::DoNotOptimize(c);
+  }
+}
+
+// Registers every benchmark above for C under "<benchmark>/<name>/...".
+// Insert and Erase sweep modify_sizes, which containers with linear-time
+// insertion and erasure can lower.
+template <typename C>
+int RegisterAll(const char *name,
+                void (*modify_sizes)(benchmark::internal::Benchmark *) =
+                    SizesAndDistributions) {
+  Register("Insert", name, BM_Insert<C>)->Apply(modify_sizes);
+  Register("Find", name, BM_Find<C>)->Apply(SizesAndDistributions);
+  Register("Erase", name, BM_Erase<C>)->Apply(modify_sizes);
+  Register("Iterate", name, BM_Iterate<C>)->Apply(SizesAndDistributions);
+  Register("Copy", name, BM_Copy<C>)->Apply(SizesAndDistributions);
+  Register("Move", name, BM_Move<C>)->Apply(SizesAndDistributions);
+  return 0;
+}
+}  // namespace bench::keyed
+
+#endif  // S21_CONTAINERS_BENCH_ASSOCIATIVE_H_
@@ -0,0 +1,12 @@
+#include "bench_associative.h"
+
+// 256-byte nodes span four cache lines, 4 KiB nodes a page
+using S21BtreeMap256 = s21::btree_map<int, int, std::less<int>, 256>;
+using S21BtreeMap4096 = s21::btree_map<int, int, std::less<int>, 4096>;
+
+namespace {
+const int kRegistered[] = {
+    bench::keyed::RegisterAll<S21BtreeMap256>("S21BtreeMap256"),
+    bench::keyed::RegisterAll<S21BtreeMap4096>("S21BtreeMap4096"),
+};
+}  // namespace
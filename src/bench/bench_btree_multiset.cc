@@ -0,0 +1,12 @@
+#include "bench_associative.h"
+
+// node sizes as in bench_btree_map.cc
+using S21BtreeMultiset256 = s21::btree_multiset<int, std::less<int>, 256>;
+using S21BtreeMultiset4096 = s21::btree_multiset<int, std::less<int>, 4096>;
+
+namespace {
+const int kRegistered[] = {
+    bench::keyed::RegisterAll<S21BtreeMultiset256>("S21BtreeMultiset256"),
+    bench::keyed::RegisterAll<S21BtreeMultiset4096>("S21BtreeMultiset4096"),
+};
+}  // namespace
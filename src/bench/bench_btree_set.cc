@@ -0,0 +1,12 @@
+#include "bench_associative.h"
+
+// node sizes as in bench_btree_map.cc
+using S21BtreeSet256 = s21::btree_set<int, std::less<int>, 256>;
+using S21BtreeSet4096 = s21::btree_set<int, std::less<int>, 4096>;
+
+namespace {
+const int kRegistered[] = {
+    bench::keyed::RegisterAll<S21BtreeSet256>("S21BtreeSet256"),
+    bench::keyed::RegisterAll<S21BtreeSet4096>("S21BtreeSet4096"),
+};
+}  // namespace
@@ -0,0 +1,24 @@
+#include "bench_sequence.h"
+
+using S21Deque = s21::deque<int>;
+using StdDeque = std::deque<int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::sequence::RegisterAll<S21Deque>("S21Deque"),
+    bench::sequence::RegisterAll<StdDeque>("StdDeque"),
+};
+}  // namespace
+
+template <typename C>
+void BM_DequePushFront(benchmark::State &state) {
+  std::vector<int> values = bench::MakeKeys(state.range(0), bench::kUniform);
+  for (auto _ : state) {
+    C c;
+    for (int value : values) c.push_front(value);
+    benchmark::DoNotOptimize(c);
+  }
+  bench::SetItems(state);
+}
+BENCHMARK_TEMPLATE(BM_DequePushFront, S21Deque)->Apply(bench::Sizes);
+BENCHMARK_TEMPLATE(BM_DequePushFront, StdDeque)->Apply(bench::Sizes);
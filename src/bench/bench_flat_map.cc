@@ -0,0 +1,13 @@
+#include "bench_associative.h"
+
+// Inserting or erasing one key shifts the entries after it, so Insert and
+// Erase stop at the quadratic sizes; the reads sweep every size, next to
+// bench_map.cc's S21Map and StdMap.
+using S21FlatMap = s21::flat_map<int, int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::keyed::RegisterAll<S21FlatMap>(
+        "S21FlatMap", bench::QuadraticSizesAndDistributions),
+};
+}  // namespace
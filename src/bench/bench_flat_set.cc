@@ -0,0 +1,11 @@
+#include "bench_associative.h"
+
+// see bench_flat_map.cc for the sizes; compare with bench_set.cc
+using S21FlatSet = s21::flat_set<int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::keyed::RegisterAll<S21FlatSet>(
+        "S21FlatSet", bench::QuadraticSizesAndDistributions),
+};
+}  // namespace
@@ -0,0 +1,27 @@
+#include "bench_sequence.h"
+
+using S21List = s21::list<int>;
+using StdList = std::list<int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::sequence::RegisterAll<S21List>("S21List"),
+    bench::sequence::RegisterAll<StdList>("StdList"),
+};
+}  // namespace
+
+template <typename C>
+void BM_ListSort(benchmark::State &state) {
+  std::vector<int> values = bench::MakeKeys(state.range(0), bench::kUniform);
+  for (auto _ : state) {
+    state.PauseTiming();
+    C c;
+    bench::sequence::Fill(c, values);
+    state.ResumeTiming();
+    c.sort();
+    benchmark::DoNotOptimize(c);
+  }
+  bench::SetItems(state);
+}
+BENCHMARK_TEMPLATE(BM_ListSort, S21List)->Apply(bench::Sizes);
+BENCHMARK_TEMPLATE(BM_ListSort, StdList)->Apply(bench::Sizes);
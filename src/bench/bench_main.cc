@@ -0,0 +1,3 @@
+#include "bench_main.h"
+
+BENCHMARK_MAIN();
@@ -0,0 +1,112 @@
+#ifndef S21_CONTAINERS_BENCH_MAIN_H_
+#define S21_CONTAINERS_BENCH_MAIN_H_
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <queue>
+#include <random>
+#include <set>
+#include <stack>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+// Largest container size swept by the benchmarks; lower it with
+// make bench BENCH_MAX_SIZE=... for a quick run.
+#ifndef S21_BENCH_MAX_SIZE
+#define S21_BENCH_MAX_SIZE 10000000
+#endif
+
+namespace bench {
+// Key distributions passed as the second benchmark argument.
+enum Distribution : int64_t {
+  kSequential = 0,  // 0, 1, 2, ... n - 1
+  kUniform = 1,     // uniformly random over the whole int range
+  kDuplicates = 2,  // random, roughly 16 copies of every key
+};
+
+inline std::vector<int> MakeKeys(size_t n, int64_t distribution) {
+  std::vector<int> keys(n);
+  std::mt19937 gen(42);
+  for (size_t i = 0; i < n; ++i) {
+    if (distribution == kSequential) {
+      keys[i] = static_cast<int>(i);
+    } else if (distribution == kUniform) {
+      keys[i] = static_cast<int>(gen());
+    } else {
+      keys[i] = static_cast<int>(gen() % (n / 16 + 1));
+    }
+  }
+  return keys;
+}
+
+// 10, 100, ... S21_BENCH_MAX_SIZE
+inline void Sizes(benchmark::internal::Benchmark *b) {
+  for (int64_t n = 10; n <= S21_BENCH_MAX_SIZE; n *= 10) b->Arg(n);
+}
+
+// 10, 100, ... up to 10^5 or S21_BENCH_MAX_SIZE if lower, for benchmarks
+// that are quadratic in the size
+inline void QuadraticSizes(benchmark::internal::Benchmark *b) {
+  const int64_t max = std::min<int64_t>(S21_BENCH_MAX_SIZE, 100000);
+  for (int64_t n = 10; n <= max; n *= 10) b->Arg(n);
+}
+
+inline void SizesAndDistributions(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"n", "dist"});
+  for (int64_t n = 10; n <= S21_BENCH_MAX_SIZE; n *= 10) {
+    for (int64_t d : {kSequential, kUniform, kDuplicates}) b->Args({n, d});
+  }
+}
+
+// SizesAndDistributions up to 10^5 or S21_BENCH_MAX_SIZE if lower, for
+// benchmarks that are quadratic in the size
+inline void QuadraticSizesAndDistributions(
+    benchmark::internal::Benchmark *b) {
+  const int64_t max = std::min<int64_t>(S21_BENCH_MAX_SIZE, 100000);
+  b->ArgNames({"n", "dist"});
+  for (int64_t n = 10; n <= max; n *= 10) {
+    for (int64_t d : {kSequential, kUniform, kDuplicates}) b->Args({n, d});
+  }
+}
+
+// s21::map and s21::set spell lookup as contains(), std ones as count()
+template <typename C, typename K>
+auto Contains(C &c, const K &key, int) -> decltype(c.contains(key)) {
+  return c.contains(key);
+}
+template <typename C, typename K>
+bool Contains(C &c, const K &key, long) {
+  return c.count(key) != 0;
+}
+template <typename C, typename K>
+bool Contains(C &c, const K &key) {
+  return Contains(c, key, 0);
+}
+
+// Names a benchmark "<benchmark>/<container>" so that the s21 and std
+// results for the same operation sit next to each other.
+inline benchmark::internal::Benchmark *Register(
+    const char *benchmark, const char *container,
+    void (*fn)(benchmark::State &)) {
+  return benchmark::RegisterBenchmark(
+      (std::string(benchmark) + "/" + container).c_str(), fn);
+}
+
+inline void SetItems(benchmark::State &state) {
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+}  // namespace bench
+
+#endif  // S21_CONTAINERS_BENCH_MAIN_H_
@@ -0,0 +1,11 @@
+#include "bench_associative.h"
+
+using S21Map = s21::map<int, int>;
+using StdMap = std::map<int, int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::keyed::RegisterAll<S21Map>("S21Map"),
+    bench::keyed::RegisterAll<StdMap>("StdMap"),
+};
+}  // namespace
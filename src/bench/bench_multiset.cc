@@ -0,0 +1,11 @@
+#include "bench_associative.h"
+
+using S21Multiset = s21::multiset<int>;
+using StdMultiset = std::multiset<int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::keyed::RegisterAll<S21Multiset>("S21Multiset"),
+    bench::keyed::RegisterAll<StdMultiset>("StdMultiset"),
+};
+}  // namespace
@@ -0,0 +1,13 @@
+#include "bench_adaptor.h"
+
+using S21Queue = s21::queue<int>;
+using S21ListQueue = s21::queue<int, s21::list<int>>;
+using StdQueue = std::queue<int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::adaptor::RegisterAll<S21Queue>("S21Queue"),
+    bench::adaptor::RegisterAll<S21ListQueue>("S21ListQueue"),
+    bench::adaptor::RegisterAll<StdQueue>("StdQueue"),
+};
+}  // namespace
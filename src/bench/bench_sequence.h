@@ -0,0 +1,101 @@
+#ifndef S21_CONTAINERS_BENCH_SEQUENCE_H_
+#define S21_CONTAINERS_BENCH_SEQUENCE_H_
+
+#include "bench_main.h"
+
+// Benchmarks shared by the sequence containers, with the size as range(0).
+// The values are random, their distribution does not matter for these.
+namespace bench::sequence {
+template <typename C>
+void Fill(C &c, const std::vector<int> &values) {
+  for (int value : values) c.push_back(value);
+}
+
+template <typename C>
+void BM_PushBack(benchmark::State &state) {
+  std::vector<int> values = MakeKeys(state.range(0), kUniform);
+  for (auto _ : state) {
+    C c;
+    Fill(c, values);
+    benchmark::DoNotOptimize(c);
+  }
+  SetItems(state);
+}
+
+// full scan for a value that is not there
+template <typename C>
+void BM_Find(benchmark::State &state) {
+  C c;
+  Fill(c, MakeKeys(state.range(0), kSequential));
+  for (auto _ : state) {
+    auto it = c.begin();
+    while (it != c.end() && *it != -1) ++it;
+    benchmark::DoNotOptimize(it);
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void BM_PopBack(benchmark::State &state) {
+  std::vector<int> values = MakeKeys(state.range(0), kUniform);
+  for (auto _ : state) {
+    state.PauseTiming();
+    C c;
+    Fill(c, values);
+    state.ResumeTiming();
+    while (!c.empty()) c.pop_back();
+    benchmark::DoNotOptimize(c);
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void BM_Iterate(benchmark::State &state) {
+  C c;
+  Fill(c, MakeKeys(state.range(0), kUniform));
+  for (auto _ : state) {
+    long sum = 0;
+    for (auto it = c.begin(); it != c.end(); ++it) sum += *it;
+    benchmark::DoNotOptimize(sum);
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void BM_Copy(benchmark::State &state) {
+  C c;
+  Fill(c, MakeKeys(state.range(0), kUniform));
+  for (auto _ : state) {
+    C copy(c);
+    benchmark::DoNotOptimize(copy);
+  }
+  SetItems(state);
+}
+
+template <typename C>
+void BM_Move(benchmark::State &state) {
+  C c;
+  Fill(c, MakeKeys(state.range(0), kUniform));
+  for (auto _ : state) {
+    C moved(std::move(c));
+    c = std::move(moved);
+    benchmark::DoNotOptimize(c);
+  }
+}
+
+// Registers every benchmark above for C under "<benchmark>/<name>/...",
+// over sizes, which containers with a fixed capacity can lower.
+template <typename C>
+int RegisterAll(const char *name,
+                void (*sizes)(benchmark::internal::Benchmark *) = Sizes) {
+  Register("PushBack", name, BM_PushBack<C>)->Apply(sizes);
+  Register("Find", name, BM_Find<C>)->Apply(sizes);
+  Register("PopBack", name, BM_PopBack<C>)->Apply(sizes);
+  Register("Iterate", name, BM_Iterate<C>)->Apply(sizes);
+  Register("Copy", name, BM_Copy<C>)->Apply(sizes);
+  Register("Move", name, BM_Move<C>)->Apply(sizes);
+  return 0;
+}
+}  // namespace bench::sequence
+
+#endif  // S21_CONTAINERS_BENCH_SEQUENCE_H_
@@ -0,0 +1,11 @@
+#include "bench_associative.h"
+
+using S21Set = s21::set<int>;
+using StdSet = std::set<int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::keyed::RegisterAll<S21Set>("S21Set"),
+    bench::keyed::RegisterAll<StdSet>("StdSet"),
+};
+}  // namespace
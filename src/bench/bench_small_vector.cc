@@ -0,0 +1,11 @@
+#include "bench_sequence.h"
+
+// N = 16 keeps the smallest size inline; the larger ones measure the heap
+// path against bench_vector.cc's S21Vector and StdVector.
+using S21SmallVector = s21::small_vector<int, 16>;
+
+namespace {
+const int kRegistered[] = {
+    bench::sequence::RegisterAll<S21SmallVector>("S21SmallVector"),
+};
+}  // namespace
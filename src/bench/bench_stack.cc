@@ -0,0 +1,13 @@
+#include "bench_adaptor.h"
+
+using S21Stack = s21::stack<int>;
+using S21ListStack = s21::stack<int, s21::list<int>>;
+using StdStack = std::stack<int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::adaptor::RegisterAll<S21Stack>("S21Stack"),
+    bench::adaptor::RegisterAll<S21ListStack>("S21ListStack"),
+    bench::adaptor::RegisterAll<StdStack>("StdStack"),
+};
+}  // namespace
@@ -0,0 +1,19 @@
+#include "bench_sequence.h"
+
+// static_vector cannot grow past its N, so the sizes stop at kCapacity;
+// compare against the same sizes of S21Vector and StdVector.
+constexpr int64_t kCapacity = 10000;
+using S21StaticVector = s21::static_vector<int, kCapacity>;
+
+namespace {
+// 10, 100, ... up to kCapacity or S21_BENCH_MAX_SIZE if lower
+void StaticSizes(benchmark::internal::Benchmark *b) {
+  const int64_t max = std::min<int64_t>(S21_BENCH_MAX_SIZE, kCapacity);
+  for (int64_t n = 10; n <= max; n *= 10) b->Arg(n);
+}
+
+const int kRegistered[] = {
+    bench::sequence::RegisterAll<S21StaticVector>("S21StaticVector",
+                                                  StaticSizes),
+};
+}  // namespace
@@ -0,0 +1,11 @@
+#include "bench_associative.h"
+
+using S21UnorderedMap = s21::unordered_map<int, int>;
+using StdUnorderedMap = std::unordered_map<int, int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::keyed::RegisterAll<S21UnorderedMap>("S21UnorderedMap"),
+    bench::keyed::RegisterAll<StdUnorderedMap>("StdUnorderedMap"),
+};
+}  // namespace
@@ -0,0 +1,11 @@
+#include "bench_associative.h"
+
+using S21UnorderedSet = s21::unordered_set<int>;
+using StdUnorderedSet = std::unordered_set<int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::keyed::RegisterAll<S21UnorderedSet>("S21UnorderedSet"),
+    bench::keyed::RegisterAll<StdUnorderedSet>("StdUnorderedSet"),
+};
+}  // namespace
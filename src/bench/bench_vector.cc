@@ -0,0 +1,25 @@
+#include "bench_sequence.h"
+
+using S21Vector = s21::vector<int>;
+using StdVector = std::vector<int>;
+
+namespace {
+const int kRegistered[] = {
+    bench::sequence::RegisterAll<S21Vector>("S21Vector"),
+    bench::sequence::RegisterAll<StdVector>("StdVector"),
+};
+}  // namespace
+
+// insert in the middle, which shifts half of the elements every time
+template <typename C>
+void BM_VectorInsertMiddle(benchmark::State &state) {
+  std::vector<int> values = bench::MakeKeys(state.range(0), bench::kUniform);
+  for (auto _ : state) {
+    C c;
+    for (int value : values) c.insert(c.begin() + c.size() / 2, value);
+    benchmark::DoNotOptimize(c);
+  }
+  bench::SetItems(state);
+}
+BENCHMARK_TEMPLATE(BM_VectorInsertMiddle, S21Vector)->Apply(bench::QuadraticSizes);
+BENCHMARK_TEMPLATE(BM_VectorInsertMiddle, StdVector)->Apply(bench::QuadraticSizes);
@@ -0,0 +1,706 @@
+#ifndef S21_CONTAINERS_S21_BTREE_BTREE_H_
+#define S21_CONTAINERS_S21_BTREE_BTREE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "../memory/s21_memory.h"
+
+namespace btree {
+// Slot layouts, as in the hash table: map slots keep a mutable key so that
+// nodes can move entries around; the containers only hand it out as const.
+template <typename Key>
+struct SetPolicy {
+  using key_type = Key;
+  using slot_type = Key;
+  static const key_type &key(const slot_type &slot) noexcept { return slot; }
+};
+
+template <typename Key, typename T>
+struct MapPolicy {
+  using key_type = Key;
+  using slot_type = std::pair<Key, T>;
+  static const key_type &key(const slot_type &slot) noexcept {
+    return slot.first;
+  }
+};
+
+// B+-tree sized in bytes per node rather than in keys: NodeBytes picks how
+// many slots a leaf and how many separators an inner node hold, so 256
+// gives a few cache lines per node and 4096 a page.
+//
+// Every entry lives in a leaf, in key order, and the leaves are chained
+// for iteration. Inner nodes hold copies of keys as separators: every key
+// under children[i] is at most keys[i], and every key under children[i + 1]
+// at least keys[i]. Equal keys may therefore sit on both sides of a
+// separator, which lets the same code serve unique and multi containers.
+//
+// Nodes other than the root stay at least half full: an overfull node is
+// split in two, an underfull one borrows an entry from a sibling or is
+// merged into it. Each node knows its parent and its index there, so
+// erase by iterator walks up without a second descent. Insertions and
+// erasures invalidate iterators.
+template <typename Policy, typename Compare, std::size_t NodeBytes,
+          bool unique_keys>
+class BTree {
+ public:
+  using key_type = typename Policy::key_type;
+  using slot_type = typename Policy::slot_type;
+  using size_type = std::size_t;
+
+ private:
+  struct InnerNode;
+  struct LeafNode;
+
+  struct NodeHeader {
+    InnerNode *parent = nullptr;
+    std::uint16_t position = 0;
+    std::uint16_t count = 0;
+    bool leaf = true;
+  };
+
+  static constexpr size_type Fanout(size_type bytes, size_type per_entry) {
+    size_type fanout = bytes / per_entry;
+    if (fanout < 4) return 4;
+    return fanout < 0xFFFF ? fanout : 0xFFFF;
+  }
+
+  static constexpr size_type kLeafSlots =
+      Fanout(NodeBytes > sizeof(NodeHeader) + 2 * sizeof(void *)
+                 ? NodeBytes - sizeof(NodeHeader) - 2 * sizeof(void *)
+                 : 0,
+             sizeof(slot_type));
+  static constexpr size_type kInnerKeys =
+      Fanout(NodeBytes > sizeof(NodeHeader) + sizeof(void *)
+                 ? NodeBytes - sizeof(NodeHeader) - sizeof(void *)
+                 : 0,
+             sizeof(key_type) + sizeof(void *));
+  static constexpr size_type kMinLeafSlots = kLeafSlots / 2;
+  // a full inner node splits into halves around the key that moves up
+  static constexpr size_type kMinInnerKeys = (kInnerKeys - 1) / 2;
+
+  struct LeafNode : NodeHeader {
+    slot_type *slots() noexcept {
+      return std::launder(reinterpret_cast<slot_type *>(storage));
+    }
+
+    LeafNode *prev = nullptr;
+    LeafNode *next = nullptr;
+    alignas(slot_type) unsigned char storage[kLeafSlots * sizeof(slot_type)];
+  };
+
+  struct InnerNode : NodeHeader {
+    InnerNode() noexcept { this->leaf = false; }
+    key_type *keys() noexcept {
+      return std::launder(reinterpret_cast<key_type *>(storage));
+    }
+
+    NodeHeader *children[kInnerKeys + 1];
+    alignas(key_type) unsigned char storage[kInnerKeys * sizeof(key_type)];
+  };
+
+ public:
+  // A leaf and an index in it; past the last slot of the last leaf is
+  // end(). Every other iterator points at an entry.
+  class Iterator {
+   public:
+    Iterator() noexcept = default;
+    Iterator(LeafNode *leaf, size_type index) noexcept
+        : leaf_(leaf), index_(index) {}
+    slot_type &operator*() const noexcept { return leaf_->slots()[index_]; }
+    slot_type *operator->() const noexcept {
+      return leaf_->slots() + index_;
+    }
+    Iterator &operator++() noexcept {
+      if (++index_ == leaf_->count && leaf_->next != nullptr) {
+        leaf_ = leaf_->next;
+        index_ = 0;
+      }
+      return *this;
+    }
+    Iterator &operator--() noexcept {
+      if (index_ == 0) {
+        leaf_ = leaf_->prev;
+        index_ = leaf_->count;
+      }
+      --index_;
+      return *this;
+    }
+    bool operator==(const Iterator &other) const noexcept {
+      return leaf_ == other.leaf_ && index_ == other.index_;
+    }
+    bool operator!=(const Iterator &other) const noexcept {
+      return !(*this == other);
+    }
+
+   private:
+    friend class BTree;
+
+    LeafNode *leaf_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  BTree() = default;
+  explicit BTree(const Compare &comp) : comp_(comp) {}
+  BTree(const BTree &other) : comp_(other.comp_) {
+    if (other.root_ == nullptr) return;
+    LeafNode *last = nullptr;
+    try {
+      root_ = CopyNode(other.root_, last);
+    } catch (...) {
+      clear();
+      throw;
+    }
+    size_ = other.size_;
+  }
+  BTree(BTree &&other) noexcept : comp_(std::move(other.comp_)) {
+    StealFrom(other);
+  }
+  ~BTree() noexcept { clear(); }
+  BTree &operator=(const BTree &other) {
+    if (this != &other) {
+      BTree copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+  BTree &operator=(BTree &&other) noexcept {
+    if (this != &other) {
+      clear();
+      comp_ = std::move(other.comp_);
+      StealFrom(other);
+    }
+    return *this;
+  }
+
+  Iterator begin() const noexcept { return Iterator(first_leaf_, 0); }
+  Iterator end() const noexcept {
+    return last_leaf_ == nullptr ? Iterator()
+                                 : Iterator(last_leaf_, last_leaf_->count);
+  }
+
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return std::numeric_limits<std::ptrdiff_t>::max() / sizeof(LeafNode) *
+           kMinLeafSlots;
+  }
+  const Compare &key_comp() const noexcept { return comp_; }
+
+  void clear() noexcept {
+    if (root_ != nullptr) DestroyNode(root_);
+    root_ = nullptr;
+    first_leaf_ = nullptr;
+    last_leaf_ = nullptr;
+    size_ = 0;
+  }
+
+  template <typename K>
+  Iterator lower_bound(const K &key) const {
+    return Bound<false>(key);
+  }
+  template <typename K>
+  Iterator upper_bound(const K &key) const {
+    return Bound<true>(key);
+  }
+  template <typename K>
+  Iterator find(const K &key) const {
+    Iterator it = lower_bound(key);
+    if (it == end() || comp_(key, Policy::key(*it))) return end();
+    return it;
+  }
+
+  // Inserts an entry built from args. A unique tree leaves args untouched
+  // when key is already present and returns that entry; a multi tree puts
+  // the entry after the equal keys it already holds.
+  template <typename K, typename... Args>
+  std::pair<Iterator, bool> emplace(const K &key, Args &&...args) {
+    if (root_ == nullptr) {
+      LeafNode *leaf = new LeafNode;
+      root_ = first_leaf_ = last_leaf_ = leaf;
+    }
+    Iterator place;
+    if constexpr (unique_keys) {
+      place = Descend<false>(key);
+      Iterator next = Normalize(place);
+      if (next != end() && !comp_(key, Policy::key(*next))) {
+        return {next, false};
+      }
+    } else {
+      place = Descend<true>(key);
+    }
+    // args may refer to an entry that a split is about to move
+    s21::memory::pending_values<slot_allocator, slot_type, 1> slot(
+        std::in_place, slot_alloc_, std::forward<Args>(args)...);
+    return {InsertAt(place.leaf_, place.index_, slot), true};
+  }
+
+  // Inserts like emplace, but skips the descent when the entry belongs
+  // right before hint within hint's leaf, or at the very end, so that an
+  // ascending run hinted with end() costs amortized O(1) per entry. Any
+  // other hint falls back to emplace.
+  template <typename K, typename... Args>
+  std::pair<Iterator, bool> emplace_hint(Iterator hint, const K &key,
+                                         Args &&...args) {
+    if (root_ == nullptr || !FitsBefore(hint, key)) {
+      return emplace(key, std::forward<Args>(args)...);
+    }
+    s21::memory::pending_values<slot_allocator, slot_type, 1> slot(
+        std::in_place, slot_alloc_, std::forward<Args>(args)...);
+    return {InsertAt(hint.leaf_, hint.index_, slot), true};
+  }
+
+  // Rebalancing afterwards copies at most one key, as the new separator,
+  // before it moves anything; if that copy throws, the entry is erased and
+  // the tree stays valid with one leaf under half full.
+  void erase(Iterator pos) {
+    LeafNode *leaf = pos.leaf_;
+    slot_type *slots = leaf->slots();
+    s21::memory::erase_shift(slot_alloc_, slots + pos.index_,
+                             slots + leaf->count);
+    --leaf->count;
+    --size_;
+    if (leaf->parent != nullptr) {
+      if (leaf->count < kMinLeafSlots) RebalanceLeaf(leaf);
+    } else if (leaf->count == 0) {
+      delete leaf;
+      root_ = nullptr;
+      first_leaf_ = nullptr;
+      last_leaf_ = nullptr;
+    }
+  }
+  size_type erase(const key_type &key) {
+    Iterator it = find(key);
+    if (it == end()) return 0;
+    erase(it);
+    return 1;
+  }
+
+  void swap(BTree &other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(first_leaf_, other.first_leaf_);
+    std::swap(last_leaf_, other.last_leaf_);
+    std::swap(size_, other.size_);
+    std::swap(comp_, other.comp_);
+  }
+
+ private:
+  using slot_allocator = std::allocator<slot_type>;
+  using key_allocator = std::allocator<key_type>;
+
+  static LeafNode *AsLeaf(NodeHeader *node) noexcept {
+    return static_cast<LeafNode *>(node);
+  }
+  static InnerNode *AsInner(NodeHeader *node) noexcept {
+    return static_cast<InnerNode *>(node);
+  }
+
+  // First index in [0, count) whose key is greater than key when upper is
+  // set, not less than key otherwise; count when there is none.
+  template <bool upper, typename K, typename KeyAt>
+  size_type Search(size_type count, const K &key, KeyAt key_at) const {
+    size_type low = 0;
+    while (count != 0) {
+      size_type half = count / 2;
+      bool right = upper ? !comp_(key, key_at(low + half))
+                         : comp_(key_at(low + half), key);
+      if (right) {
+        low += half + 1;
+        count -= half + 1;
+      } else {
+        count = half;
+      }
+    }
+    return low;
+  }
+
+  // The leaf slot a bound search ends at, which may be one past the last
+  // slot of its leaf. The tree must not be empty.
+  template <bool upper, typename K>
+  Iterator Descend(const K &key) const {
+    NodeHeader *node = root_;
+    while (!node->leaf) {
+      InnerNode *inner = AsInner(node);
+      node = inner->children[Search<upper>(
+          inner->count, key,
+          [inner](size_type i) -> const key_type & {
+            return inner->keys()[i];
+          })];
+    }
+    LeafNode *leaf = AsLeaf(node);
+    size_type index = Search<upper>(
+        leaf->count, key, [leaf](size_type i) -> const key_type & {
+          return Policy::key(leaf->slots()[i]);
+        });
+    return Iterator(leaf, index);
+  }
+
+  // moves a one-past-the-end position of an inner leaf to the next leaf
+  static Iterator Normalize(Iterator it) noexcept {
+    if (it.index_ == it.leaf_->count && it.leaf_->next != nullptr) {
+      return Iterator(it.leaf_->next, 0);
+    }
+    return it;
+  }
+
+  // Whether key can go at it without touching the separators above: it
+  // must not be the first slot of a leaf with a previous sibling, and key
+  // must fall between its neighbours in the leaf, strictly so in a unique
+  // tree.
+  template <typename K>
+  bool FitsBefore(Iterator it, const K &key) const {
+    slot_type *slots = it.leaf_->slots();
+    if (it.index_ == 0) {
+      if (it.leaf_->prev != nullptr) return false;
+    } else if (unique_keys ? !comp_(Policy::key(slots[it.index_ - 1]), key)
+                           : comp_(key, Policy::key(slots[it.index_ - 1]))) {
+      return false;
+    }
+    if (it.index_ == it.leaf_->count) return true;
+    return unique_keys ? comp_(key, Policy::key(slots[it.index_]))
+                       : !comp_(Policy::key(slots[it.index_]), key);
+  }
+
+  template <bool upper, typename K>
+  Iterator Bound(const K &key) const {
+    if (root_ == nullptr) return end();
+    return Normalize(Descend<upper>(key));
+  }
+
+  template <typename Pending>
+  Iterator InsertAt(LeafNode *leaf, size_type index, Pending &slot) {
+    if (leaf->count == kLeafSlots) {
+      LeafNode *right = SplitLeaf(leaf);
+      if (index > leaf->count) {
+        index -= leaf->count;
+        leaf = right;
+      }
+    }
+    slot_type *slots = leaf->slots();
+    slot_type *finish = slots + leaf->count;
+    slot.insert_at(slots + index, finish);
+    ++leaf->count;
+    ++size_;
+    return Iterator(leaf, index);
+  }
+
+  // Moves the upper half of a full leaf into a new right sibling.
+  LeafNode *SplitLeaf(LeafNode *leaf) {
+    LeafNode *right = new LeafNode;
+    size_type keep = leaf->count / 2;
+    try {
+      InsertChild(leaf, key_type(Policy::key(leaf->slots()[keep])), right);
+    } catch (...) {
+      delete right;
+      throw;
+    }
+    s21::memory::relocate(slot_alloc_, leaf->slots() + keep,
+                          leaf->count - keep, right->slots());
+    right->count = static_cast<std::uint16_t>(leaf->count - keep);
+    leaf->count = static_cast<std::uint16_t>(keep);
+
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next != nullptr) {
+      leaf->next->prev = right;
+    } else {
+      last_leaf_ = right;
+    }
+    leaf->next = right;
+    return right;
+  }
+
+  // Moves the keys after the middle one, and the children after them, into
+  // a new right sibling; the middle key goes up as their separator.
+  void SplitInner(InnerNode *node) {
+    InnerNode *right = new InnerNode;
+    size_type middle = node->count / 2;
+    key_type *keys = node->keys();
+    try {
+      InsertChild(node, key_type(keys[middle]), right);
+    } catch (...) {
+      delete right;
+      throw;
+    }
+    size_type moved = node->count - middle - 1;
+    s21::memory::relocate(key_alloc_, keys + middle + 1, moved,
+                          right->keys());
+    std::allocator_traits<key_allocator>::destroy(key_alloc_, keys + middle);
+    for (size_type i = 0; i <= moved; ++i) {
+      SetChild(right, i, node->children[middle + 1 + i]);
+    }
+    right->count = static_cast<std::uint16_t>(moved);
+    node->count = static_cast<std::uint16_t>(middle);
+  }
+
+  // Links right into the tree as the next sibling of node, with key as the
+  // separator between the two, splitting full ancestors on the way.
+  void InsertChild(NodeHeader *node, key_type &&key, NodeHeader *right) {
+    if (node->parent == nullptr) {
+      InnerNode *root = new InnerNode;
+      try {
+        std::allocator_traits<key_allocator>::construct(
+            key_alloc_, root->keys(), std::move(key));
+      } catch (...) {
+        delete root;
+        throw;
+      }
+      root->count = 1;
+      SetChild(root, 0, node);
+      SetChild(root, 1, right);
+      root_ = root;
+      return;
+    }
+    if (node->parent->count == kInnerKeys) SplitInner(node->parent);
+    InnerNode *parent = node->parent;
+    size_type index = node->position;
+    key_type *keys = parent->keys();
+    key_type *finish = keys + parent->count;
+    s21::memory::pending_values<key_allocator, key_type, 1>(
+        std::in_place, key_alloc_, std::move(key))
+        .insert_at(keys + index, finish);
+    for (size_type i = parent->count + 1; i > index + 1; --i) {
+      SetChild(parent, i, parent->children[i - 1]);
+    }
+    SetChild(parent, index + 1, right);
+    ++parent->count;
+  }
+
+  static void SetChild(InnerNode *parent, size_type index,
+                       NodeHeader *child) noexcept {
+    parent->children[index] = child;
+    child->parent = parent;
+    child->position = static_cast<std::uint16_t>(index);
+  }
+
+  // Drops key index of node together with the child to its right.
+  void RemoveChild(InnerNode *node, size_type index) {
+    key_type *keys = node->keys();
+    s21::memory::erase_shift(key_alloc_, keys + index, keys + node->count);
+    for (size_type i = index + 1; i < node->count; ++i) {
+      SetChild(node, i, node->children[i + 1]);
+    }
+    --node->count;
+  }
+
+  // Refills a leaf that dropped below half: it borrows a slot from a
+  // sibling that can spare one, or else merges with a sibling. A borrow
+  // copies the new separator first, so a throwing copy changes nothing.
+  void RebalanceLeaf(LeafNode *leaf) {
+    InnerNode *parent = leaf->parent;
+    size_type index = leaf->position;
+    LeafNode *left =
+        index > 0 ? AsLeaf(parent->children[index - 1]) : nullptr;
+    LeafNode *right = index < parent->count
+                          ? AsLeaf(parent->children[index + 1])
+                          : nullptr;
+    if (left != nullptr && left->count > kMinLeafSlots) {
+      slot_type *last = left->slots() + left->count - 1;
+      key_type separator(Policy::key(*last));
+      s21::memory::pending_values<slot_allocator, slot_type, 1> slot(
+          std::in_place, slot_alloc_, std::move(*last));
+      std::allocator_traits<slot_allocator>::destroy(slot_alloc_, last);
+      --left->count;
+      slot_type *slots = leaf->slots();
+      slot_type *finish = slots + leaf->count;
+      slot.insert_at(slots, finish);
+      ++leaf->count;
+      parent->keys()[index - 1] = std::move(separator);
+    } else if (right != nullptr && right->count > kMinLeafSlots) {
+      slot_type *first = right->slots();
+      key_type separator(Policy::key(first[1]));
+      std::allocator_traits<slot_allocator>::construct(
+          slot_alloc_, leaf->slots() + leaf->count, std::move(*first));
+      ++leaf->count;
+      s21::memory::erase_shift(slot_alloc_, first, first + right->count);
+      --right->count;
+      parent->keys()[index] = std::move(separator);
+    } else if (left != nullptr) {
+      MergeLeaves(left, leaf);
+    } else {
+      MergeLeaves(leaf, right);
+    }
+  }
+
+  // Moves every slot of right into left, its previous sibling, and drops
+  // right from the tree.
+  void MergeLeaves(LeafNode *left, LeafNode *right) {
+    s21::memory::relocate(slot_alloc_, right->slots(), right->count,
+                          left->slots() + left->count);
+    left->count = static_cast<std::uint16_t>(left->count + right->count);
+    left->next = right->next;
+    if (right->next != nullptr) {
+      right->next->prev = left;
+    } else {
+      last_leaf_ = left;
+    }
+    InnerNode *parent = right->parent;
+    RemoveChild(parent, right->position - 1);
+    delete right;
+    RebalanceInner(parent);
+  }
+
+  void RebalanceInner(InnerNode *node) {
+    if (node->parent == nullptr) {
+      if (node->count == 0) {
+        root_ = node->children[0];
+        root_->parent = nullptr;
+        root_->position = 0;
+        delete node;
+      }
+      return;
+    }
+    if (node->count >= kMinInnerKeys) return;
+    InnerNode *parent = node->parent;
+    size_type index = node->position;
+    InnerNode *left =
+        index > 0 ? AsInner(parent->children[index - 1]) : nullptr;
+    InnerNode *right = index < parent->count
+                           ? AsInner(parent->children[index + 1])
+                           : nullptr;
+    if (left != nullptr && left->count > kMinInnerKeys) {
+      // rotate right: the separator comes down, left's last key goes up
+      key_type *keys = node->keys();
+      key_type *finish = keys + node->count;
+      s21::memory::pending_values<key_allocator, key_type, 1>(
+          std::in_place, key_alloc_, std::move(parent->keys()[index - 1]))
+          .insert_at(keys, finish);
+      for (size_type i = node->count + 1; i > 0; --i) {
+        SetChild(node, i, node->children[i - 1]);
+      }
+      SetChild(node, 0, left->children[left->count]);
+      ++node->count;
+      key_type *last = left->keys() + left->count - 1;
+      parent->keys()[index - 1] = std::move(*last);
+      std::allocator_traits<key_allocator>::destroy(key_alloc_, last);
+      --left->count;
+    } else if (right != nullptr && right->count > kMinInnerKeys) {
+      // rotate left: the separator comes down, right's first key goes up
+      std::allocator_traits<key_allocator>::construct(
+          key_alloc_, node->keys() + node->count,
+          std::move(parent->keys()[index]));
+      SetChild(node, node->count + 1, right->children[0]);
+      ++node->count;
+      key_type *first = right->keys();
+      parent->keys()[index] = std::move(*first);
+      s21::memory::erase_shift(key_alloc_, first, first + right->count);
+      for (size_type i = 0; i < right->count; ++i) {
+        SetChild(right, i, right->children[i + 1]);
+      }
+      --right->count;
+    } else if (left != nullptr) {
+      MergeInner(left, node);
+    } else {
+      MergeInner(node, right);
+    }
+  }
+
+  // Appends the separator and everything of right to left, its previous
+  // sibling, and drops right from the tree.
+  void MergeInner(InnerNode *left, InnerNode *right) {
+    InnerNode *parent = left->parent;
+    size_type index = left->position;
+    key_type *keys = left->keys();
+    std::allocator_traits<key_allocator>::construct(
+        key_alloc_, keys + left->count, std::move(parent->keys()[index]));
+    s21::memory::relocate(key_alloc_, right->keys(), right->count,
+                          keys + left->count + 1);
+    for (size_type i = 0; i <= right->count; ++i) {
+      SetChild(left, left->count + 1 + i, right->children[i]);
+    }
+    left->count = static_cast<std::uint16_t>(left->count + 1 + right->count);
+    right->count = 0;
+    RemoveChild(parent, index);
+    delete right;
+    RebalanceInner(parent);
+  }
+
+  // Copies the subtree under node and chains its leaves after last, the
+  // leaf copied before them. On failure the nodes built so far are freed.
+  NodeHeader *CopyNode(NodeHeader *node, LeafNode *&last) {
+    if (node->leaf) {
+      LeafNode *src = AsLeaf(node);
+      LeafNode *leaf = new LeafNode;
+      try {
+        s21::memory::uninitialized_copy(slot_alloc_, src->slots(), src->count,
+                                        leaf->slots());
+      } catch (...) {
+        delete leaf;
+        throw;
+      }
+      leaf->count = src->count;
+      leaf->prev = last;
+      if (last != nullptr) {
+        last->next = leaf;
+      } else {
+        first_leaf_ = leaf;
+      }
+      last = last_leaf_ = leaf;
+      return leaf;
+    }
+    InnerNode *src = AsInner(node);
+    InnerNode *inner = new InnerNode;
+    size_type children = 0;
+    try {
+      for (; children <= src->count; ++children) {
+        if (children != 0) {
+          std::allocator_traits<key_allocator>::construct(
+              key_alloc_, inner->keys() + children - 1,
+              src->keys()[children - 1]);
+          inner->count = static_cast<std::uint16_t>(children);
+        }
+        SetChild(inner, children, CopyNode(src->children[children], last));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < children; ++i) DestroyNode(inner->children[i]);
+      s21::memory::destroy(key_alloc_, inner->keys(),
+                           inner->keys() + inner->count);
+      delete inner;
+      throw;
+    }
+    return inner;
+  }
+
+  void DestroyNode(NodeHeader *node) noexcept {
+    if (node->leaf) {
+      LeafNode *leaf = AsLeaf(node);
+      s21::memory::destroy(slot_alloc_, leaf->slots(),
+                           leaf->slots() + leaf->count);
+      delete leaf;
+    } else {
+      InnerNode *inner = AsInner(node);
+      for (size_type i = 0; i <= inner->count; ++i) {
+        DestroyNode(inner->children[i]);
+      }
+      s21::memory::destroy(key_alloc_, inner->keys(),
+                           inner->keys() + inner->count);
+      delete inner;
+    }
+  }
+
+  void StealFrom(BTree &other) noexcept {
+    root_ = other.root_;
+    first_leaf_ = other.first_leaf_;
+    last_leaf_ = other.last_leaf_;
+    size_ = other.size_;
+    other.root_ = nullptr;
+    other.first_leaf_ = nullptr;
+    other.last_leaf_ = nullptr;
+    other.size_ = 0;
+  }
+
+  NodeHeader *root_ = nullptr;
+  LeafNode *first_leaf_ = nullptr;
+  LeafNode *last_leaf_ = nullptr;
+  size_type size_ = 0;
+  Compare comp_ = Compare();
+  slot_allocator slot_alloc_;
+  key_allocator key_alloc_;
+};
+}  // namespace btree
+
+#endif  // S21_CONTAINERS_S21_BTREE_BTREE_H_
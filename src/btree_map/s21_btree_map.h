@@ -0,0 +1,264 @@
+#ifndef S21_CONTAINERS_S21_BTREE_MAP_BTREE_MAP_H_
+#define S21_CONTAINERS_S21_BTREE_MAP_BTREE_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "../btree/s21_btree.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+// Ordered map on a B+-tree: the s21::map interface, with many entries per
+// node instead of one. NodeBytes sets the node size, e.g. 256 for a few
+// cache lines or 4096 for a page; bigger nodes mean a shallower tree.
+// Unlike s21::map, inserting or erasing invalidates iterators, and there
+// is no extract() or node_type: entries live in leaf arrays and move on
+// every split, so there is no node to hand out. nth() and rank() are left
+// out too, since inner nodes keep no subtree sizes.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          std::size_t NodeBytes = 256>
+class btree_map {
+  using tree_type =
+      btree::BTree<btree::MapPolicy<Key, T>, Compare, NodeBytes, true>;
+  using tree_iterator = typename tree_type::Iterator;
+
+ public:
+  class BtreeMapIterator;
+  class BtreeMapConstIterator;
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = BtreeMapIterator;
+  using const_iterator = BtreeMapConstIterator;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  // btree_map member functions
+  btree_map() = default;
+  explicit btree_map(const Compare &comp) : tree(comp) {}
+  btree_map(std::initializer_list<value_type> const &items) {
+    assign_sorted(items.begin(), items.end());
+  }
+  template <typename InputIt,
+            typename = decltype(*std::declval<InputIt &>())>
+  btree_map(InputIt first, InputIt last) {
+    assign_sorted(first, last);
+  }
+  btree_map(const btree_map &m) = default;
+  btree_map(btree_map &&m) noexcept = default;
+  ~btree_map() noexcept = default;
+  btree_map &operator=(const btree_map &m) = default;
+  btree_map &operator=(btree_map &&m) noexcept = default;
+
+  // btree_map element access
+  T &at(const Key &key) {
+    iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("No key in the btree_map");
+    }
+    return (*it).second;
+  }
+  const T &at(const Key &key) const {
+    const_iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("No key in the btree_map");
+    }
+    return (*it).second;
+  }
+  T &operator[](const Key &key) { return (*try_emplace(key).first).second; }
+  T &operator[](Key &&key) {
+    return (*try_emplace(std::move(key)).first).second;
+  }
+
+  // btree_map iterators; entries are handed out as a pair of references so
+  // that the key stays read-only while the nodes can still move it
+  class BtreeMapIterator {
+   public:
+    BtreeMapIterator() noexcept = default;
+    BtreeMapIterator(tree_iterator it) noexcept : it_(it) {}
+    std::pair<const key_type &, mapped_type &> operator*() const noexcept {
+      return std::pair<const key_type &, mapped_type &>(it_->first,
+                                                        it_->second);
+    }
+    BtreeMapIterator &operator++() noexcept {
+      ++it_;
+      return *this;
+    }
+    BtreeMapIterator operator++(int) noexcept {
+      BtreeMapIterator it(*this);
+      ++it_;
+      return it;
+    }
+    BtreeMapIterator &operator--() noexcept {
+      --it_;
+      return *this;
+    }
+    BtreeMapIterator operator--(int) noexcept {
+      BtreeMapIterator it(*this);
+      --it_;
+      return it;
+    }
+    bool operator==(const BtreeMapIterator &other) const noexcept {
+      return it_ == other.it_;
+    }
+    bool operator!=(const BtreeMapIterator &other) const noexcept {
+      return it_ != other.it_;
+    }
+
+   private:
+    friend class btree_map;
+    tree_iterator it_;
+  };
+  class BtreeMapConstIterator {
+   public:
+    BtreeMapConstIterator() noexcept = default;
+    BtreeMapConstIterator(tree_iterator it) noexcept : it_(it) {}
+    BtreeMapConstIterator(const BtreeMapIterator &other) noexcept
+        : it_(other.it_) {}
+    std::pair<const key_type &, const mapped_type &> operator*()
+        const noexcept {
+      return std::pair<const key_type &, const mapped_type &>(it_->first,
+                                                              it_->second);
+    }
+    BtreeMapConstIterator &operator++() noexcept {
+      ++it_;
+      return *this;
+    }
+    BtreeMapConstIterator operator++(int) noexcept {
+      BtreeMapConstIterator it(*this);
+      ++it_;
+      return it;
+    }
+    BtreeMapConstIterator &operator--() noexcept {
+      --it_;
+      return *this;
+    }
+    BtreeMapConstIterator operator--(int) noexcept {
+      BtreeMapConstIterator it(*this);
+      --it_;
+      return it;
+    }
+    bool operator==(const BtreeMapConstIterator &other) const noexcept {
+      return it_ == other.it_;
+    }
+    bool operator!=(const BtreeMapConstIterator &other) const noexcept {
+      return it_ != other.it_;
+    }
+
+   private:
+    friend class btree_map;
+    tree_iterator it_;
+  };
+
+  iterator begin() noexcept { return tree.begin(); }
+  iterator end() noexcept { return tree.end(); }
+  const_iterator begin() const noexcept { return tree.begin(); }
+  const_iterator end() const noexcept { return tree.end(); }
+
+  // btree_map capacity
+  bool empty() const noexcept { return tree.size() == 0; }
+  size_type size() const noexcept { return tree.size(); }
+  size_type max_size() const noexcept { return tree.max_size(); }
+
+  // btree_map modifiers
+  void clear() noexcept { tree.clear(); }
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return try_emplace(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return try_emplace(key, obj);
+  }
+  std::pair<iterator, bool> insert(Key &&key, T &&obj) {
+    return try_emplace(std::move(key), std::move(obj));
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    std::pair<iterator, bool> p = try_emplace(key, obj);
+    if (!p.second) (*p.first).second = obj;
+    return p;
+  }
+  // builds the pair first, the key is needed before a leaf can be chosen
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    std::pair<key_type, mapped_type> value(std::forward<Args>(args)...);
+    return tree.emplace(value.first, std::move(value));
+  }
+  // hinted insertion, amortized O(1) when the entry belongs right before
+  // hint
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree.emplace_hint(hint.it_, value.first, value).first;
+  }
+  iterator insert(const_iterator hint, value_type &&value) {
+    return tree.emplace_hint(hint.it_, value.first, std::move(value)).first;
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    std::pair<key_type, mapped_type> value(std::forward<Args>(args)...);
+    return tree.emplace_hint(hint.it_, value.first, std::move(value)).first;
+  }
+  // leaves args untouched when the key is already present
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args) {
+    return tree.emplace(key, std::piecewise_construct,
+                        std::forward_as_tuple(key),
+                        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args) {
+    return tree.emplace(key, std::piecewise_construct,
+                        std::forward_as_tuple(std::move(key)),
+                        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  // replaces the contents; input already in key order is appended to the
+  // last leaf in amortized O(1) per entry
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    clear();
+    for (; first != last; ++first) insert(end(), *first);
+  }
+  void erase(iterator pos) { tree.erase(pos.it_); }
+  void erase(const key_type &key) { tree.erase(key); }
+  void swap(btree_map &other) noexcept { tree.swap(other.tree); }
+  // moves over the entries of other whose keys are not present yet
+  void merge(btree_map &other) {
+    if (&other == this) return;
+    tree_type rest;
+    for (auto &entry : other.tree) {
+      if (!tree.emplace(entry.first, std::move(entry)).second) {
+        rest.emplace(entry.first, std::move(entry));
+      }
+    }
+    other.tree.swap(rest);
+  }
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+
+    res.reserve(sizeof...(args));
+    (res.push_back(emplace(std::forward<Args>(args))), ...);
+    return res;
+  }
+
+  // btree_map lookup
+  iterator find(const key_type &key) { return tree.find(key); }
+  const_iterator find(const key_type &key) const { return tree.find(key); }
+  bool contains(const key_type &key) const {
+    return tree.find(key) != tree.end();
+  }
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+  iterator lower_bound(const key_type &key) { return tree.lower_bound(key); }
+  iterator upper_bound(const key_type &key) { return tree.upper_bound(key); }
+
+  // btree_map observers
+  key_compare key_comp() const { return tree.key_comp(); }
+
+ private:
+  tree_type tree;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_BTREE_MAP_BTREE_MAP_H_
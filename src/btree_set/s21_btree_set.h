@@ -0,0 +1,170 @@
+#ifndef S21_CONTAINERS_S21_BTREE_SET_BTREE_SET_H_
+#define S21_CONTAINERS_S21_BTREE_SET_BTREE_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "../btree/s21_btree.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+// Ordered set on a B+-tree, see btree_map for NodeBytes and for what it
+// leaves out of the s21::set interface. Inserting or erasing invalidates
+// iterators.
+template <typename Key, typename Compare = std::less<Key>,
+          std::size_t NodeBytes = 256>
+class btree_set {
+  using tree_type =
+      btree::BTree<btree::SetPolicy<Key>, Compare, NodeBytes, true>;
+  using tree_iterator = typename tree_type::Iterator;
+
+ public:
+  class BtreeSetIterator;
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = BtreeSetIterator;
+  using const_iterator = BtreeSetIterator;
+  using size_type = size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+
+  // btree_set member functions
+  btree_set() = default;
+  explicit btree_set(const Compare &comp) : tree(comp) {}
+  btree_set(std::initializer_list<value_type> const &items) {
+    assign_sorted(items.begin(), items.end());
+  }
+  template <typename InputIt,
+            typename = decltype(*std::declval<InputIt &>())>
+  btree_set(InputIt first, InputIt last) {
+    assign_sorted(first, last);
+  }
+  btree_set(const btree_set &s) = default;
+  btree_set(btree_set &&s) noexcept = default;
+  ~btree_set() noexcept = default;
+  btree_set &operator=(const btree_set &s) = default;
+  btree_set &operator=(btree_set &&s) noexcept = default;
+
+  // btree_set iterators
+  class BtreeSetIterator {
+   public:
+    BtreeSetIterator() noexcept = default;
+    BtreeSetIterator(tree_iterator it) noexcept : it_(it) {}
+    const_reference operator*() const noexcept { return *it_; }
+    const value_type *operator->() const noexcept { return &*it_; }
+    BtreeSetIterator &operator++() noexcept {
+      ++it_;
+      return *this;
+    }
+    BtreeSetIterator operator++(int) noexcept {
+      BtreeSetIterator it(*this);
+      ++it_;
+      return it;
+    }
+    BtreeSetIterator &operator--() noexcept {
+      --it_;
+      return *this;
+    }
+    BtreeSetIterator operator--(int) noexcept {
+      BtreeSetIterator it(*this);
+      --it_;
+      return it;
+    }
+    bool operator==(const BtreeSetIterator &other) const noexcept {
+      return it_ == other.it_;
+    }
+    bool operator!=(const BtreeSetIterator &other) const noexcept {
+      return it_ != other.it_;
+    }
+
+   private:
+    friend class btree_set;
+    tree_iterator it_;
+  };
+
+  iterator begin() const noexcept { return tree.begin(); }
+  iterator end() const noexcept { return tree.end(); }
+
+  // btree_set capacity
+  bool empty() const noexcept { return tree.size() == 0; }
+  size_type size() const noexcept { return tree.size(); }
+  size_type max_size() const noexcept { return tree.max_size(); }
+
+  // btree_set modifiers
+  void clear() noexcept { tree.clear(); }
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree.emplace(value, value);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tree.emplace(value, std::move(value));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+  // hinted insertion, amortized O(1) when the element belongs right
+  // before hint
+  iterator insert(const_iterator hint, const value_type &value) {
+    return tree.emplace_hint(hint.it_, value, value).first;
+  }
+  iterator insert(const_iterator hint, value_type &&value) {
+    return tree.emplace_hint(hint.it_, value, std::move(value)).first;
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return insert(hint, value_type(std::forward<Args>(args)...));
+  }
+  // replaces the contents; input already in key order is appended to the
+  // last leaf in amortized O(1) per element
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    clear();
+    for (; first != last; ++first) insert(end(), *first);
+  }
+  void erase(iterator pos) { tree.erase(pos.it_); }
+  void erase(const key_type &key) { tree.erase(key); }
+  void swap(btree_set &other) noexcept { tree.swap(other.tree); }
+  // moves over the elements of other that are not present yet
+  void merge(btree_set &other) {
+    if (&other == this) return;
+    tree_type rest;
+    for (value_type &value : other.tree) {
+      if (!tree.emplace(value, std::move(value)).second) {
+        rest.emplace(value, std::move(value));
+      }
+    }
+    other.tree.swap(rest);
+  }
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+
+    res.reserve(sizeof...(args));
+    (res.push_back(insert(std::forward<Args>(args))), ...);
+    return res;
+  }
+
+  // btree_set lookup
+  iterator find(const key_type &key) const { return tree.find(key); }
+  bool contains(const key_type &key) const { return find(key) != end(); }
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+  iterator lower_bound(const key_type &key) const {
+    return tree.lower_bound(key);
+  }
+  iterator upper_bound(const key_type &key) const {
+    return tree.upper_bound(key);
+  }
+
+  // btree_set observers
+  key_compare key_comp() const { return tree.key_comp(); }
+  value_compare value_comp() const { return tree.key_comp(); }
+
+ private:
+  tree_type tree;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_BTREE_SET_BTREE_SET_H_
@@ -0,0 +1,394 @@
+#ifndef S21_CONTAINERS_S21_DEQUE_DEQUE_H_
+#define S21_CONTAINERS_S21_DEQUE_DEQUE_H_
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/s21_memory.h"
+
+namespace s21 {
+// Double-ended queue on a ring buffer: one block whose capacity is a power
+// of two, with the elements wrapping around its end. Pushing and popping
+// at either end is amortised O(1) and only allocates when the block is
+// full, which doubles it. Growing moves the elements, so it invalidates
+// iterators and references; there is no insertion or erasure in the
+// middle.
+template <typename T, typename Allocator = std::allocator<T>>
+class deque {
+ public:
+  template <typename Value>
+  class DequeIterator;
+  // deque member type
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = DequeIterator<T>;
+  using const_iterator = DequeIterator<const T>;
+  using size_type = size_t;
+
+  // deque member functions
+  deque() noexcept(noexcept(Allocator()))
+      : buffer(nullptr), head(0), count(0), allocd(0), alloc() {}
+  explicit deque(const Allocator &a) noexcept
+      : buffer(nullptr), head(0), count(0), allocd(0), alloc(a) {}
+  explicit deque(size_type n, const Allocator &a = Allocator()) : deque(a) {
+    reserve(n);
+    while (count != n) {
+      emplace_back();
+    }
+  }
+  deque(std::initializer_list<value_type> const &items,
+        const Allocator &a = Allocator())
+      : deque(a) {
+    reserve(items.size());
+    for (auto &item : items) {
+      push_back(item);
+    }
+  }
+  deque(const deque &d)
+      : deque(alloc_traits::select_on_container_copy_construction(d.alloc)) {
+    *this = d;
+  }
+  deque(deque &&d) noexcept
+      : buffer(d.buffer),
+        head(d.head),
+        count(d.count),
+        allocd(d.allocd),
+        alloc(std::move(d.alloc)) {
+    d.null();
+  }
+  ~deque() noexcept { free_storage(); }
+  deque &operator=(const deque &d) {
+    if (this != &d) {
+      clear();
+      reserve(d.count);
+      for (const_reference item : d) {
+        push_back(item);
+      }
+    }
+    return *this;
+  }
+  deque &operator=(deque &&d) noexcept {
+    if (this != &d) {
+      free_storage();
+      alloc = std::move(d.alloc);
+      buffer = d.buffer;
+      head = d.head;
+      count = d.count;
+      allocd = d.allocd;
+      d.null();
+    }
+    return *this;
+  }
+  allocator_type get_allocator() const noexcept { return alloc; }
+
+  // deque element access
+  reference at(size_type pos) {
+    if (pos >= count) throw std::out_of_range("pos is out of the scope");
+    return *slot(pos);
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= count) throw std::out_of_range("pos is out of the scope");
+    return *slot(pos);
+  }
+  reference operator[](size_type pos) noexcept { return *slot(pos); }
+  const_reference operator[](size_type pos) const noexcept {
+    return *slot(pos);
+  }
+  reference front() noexcept { return buffer[head]; }
+  const_reference front() const noexcept { return buffer[head]; }
+  reference back() noexcept { return *slot(count - 1); }
+  const_reference back() const noexcept { return *slot(count - 1); }
+
+  // deque iterators; the index counts from the block start without
+  // wrapping, so that iterators order and subtract like positions
+  template <typename Value>
+  class DequeIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    DequeIterator() noexcept = default;
+    DequeIterator(Value *buffer, size_type mask, size_type index) noexcept
+        : buffer_(buffer), mask_(mask), index_(index) {}
+    template <typename Other,
+              typename = std::enable_if_t<std::is_const<Value>::value &&
+                                          !std::is_const<Other>::value>>
+    DequeIterator(const DequeIterator<Other> &other) noexcept
+        : buffer_(other.buffer_), mask_(other.mask_), index_(other.index_) {}
+    Value &operator*() const noexcept { return buffer_[index_ & mask_]; }
+    Value *operator->() const noexcept { return buffer_ + (index_ & mask_); }
+    Value &operator[](std::ptrdiff_t n) const noexcept {
+      return buffer_[(index_ + n) & mask_];
+    }
+    DequeIterator &operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+    DequeIterator operator++(int) noexcept {
+      DequeIterator it(*this);
+      ++index_;
+      return it;
+    }
+    DequeIterator &operator--() noexcept {
+      --index_;
+      return *this;
+    }
+    DequeIterator operator--(int) noexcept {
+      DequeIterator it(*this);
+      --index_;
+      return it;
+    }
+    DequeIterator &operator+=(std::ptrdiff_t n) noexcept {
+      index_ += n;
+      return *this;
+    }
+    DequeIterator &operator-=(std::ptrdiff_t n) noexcept {
+      index_ -= n;
+      return *this;
+    }
+    DequeIterator operator+(std::ptrdiff_t n) const noexcept {
+      return DequeIterator(buffer_, mask_, index_ + n);
+    }
+    DequeIterator operator-(std::ptrdiff_t n) const noexcept {
+      return DequeIterator(buffer_, mask_, index_ - n);
+    }
+    std::ptrdiff_t operator-(const DequeIterator &other) const noexcept {
+      return static_cast<std::ptrdiff_t>(index_ - other.index_);
+    }
+    bool operator==(const DequeIterator &other) const noexcept {
+      return index_ == other.index_ && buffer_ == other.buffer_;
+    }
+    bool operator!=(const DequeIterator &other) const noexcept {
+      return !(*this == other);
+    }
+    bool operator<(const DequeIterator &other) const noexcept {
+      return index_ < other.index_;
+    }
+    bool operator>(const DequeIterator &other) const noexcept {
+      return other < *this;
+    }
+    bool operator<=(const DequeIterator &other) const noexcept {
+      return !(other < *this);
+    }
+    bool operator>=(const DequeIterator &other) const noexcept {
+      return !(*this < other);
+    }
+
+   private:
+    template <typename>
+    friend class DequeIterator;
+
+    Value *buffer_ = nullptr;
+    size_type mask_ = 0;
+    size_type index_ = 0;
+  };
+
+  iterator begin() noexcept { return iterator(buffer, mask(), head); }
+  iterator end() noexcept { return iterator(buffer, mask(), head + count); }
+  const_iterator begin() const noexcept {
+    return const_iterator(buffer, mask(), head);
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(buffer, mask(), head + count);
+  }
+
+  // deque capacity
+  bool empty() const noexcept { return count == 0; }
+  size_type size() const noexcept { return count; }
+  size_type max_size() const noexcept { return LONG_MAX / sizeof(value_type); }
+  // only ever grows, to the next power of two
+  void reserve(size_type size) {
+    if (size > max_size()) throw std::length_error("deque size is too big");
+    if (size > allocd) reallocate(round_up(size));
+  }
+  size_type capacity() const noexcept { return allocd; }
+  void shrink_to_fit() {
+    if (count == 0) {
+      free_storage();
+    } else if (round_up(count) != allocd) {
+      reallocate(round_up(count));
+    }
+  }
+
+  // deque modifiers
+  void clear() noexcept {
+    destroy_all();
+    head = 0;
+    count = 0;
+  }
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(value_type &&value) { emplace_front(std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (count == allocd) {
+      grow_and_construct(true, std::forward<Args>(args)...);
+    } else {
+      alloc_traits::construct(alloc, slot(count), std::forward<Args>(args)...);
+      ++count;
+    }
+    return back();
+  }
+  template <typename... Args>
+  reference emplace_front(Args &&...args) {
+    if (count == allocd) {
+      grow_and_construct(false, std::forward<Args>(args)...);
+    } else {
+      size_type new_head = (head - 1) & mask();
+      alloc_traits::construct(alloc, buffer + new_head,
+                              std::forward<Args>(args)...);
+      head = new_head;
+      ++count;
+    }
+    return front();
+  }
+  void pop_back() noexcept {
+    if (!empty()) {
+      --count;
+      alloc_traits::destroy(alloc, slot(count));
+    }
+  }
+  void pop_front() noexcept {
+    if (!empty()) {
+      alloc_traits::destroy(alloc, buffer + head);
+      head = (head + 1) & mask();
+      --count;
+    }
+  }
+  void swap(deque &other) noexcept {
+    std::swap(buffer, other.buffer);
+    std::swap(head, other.head);
+    std::swap(count, other.count);
+    std::swap(allocd, other.allocd);
+    std::swap(alloc, other.alloc);
+  }
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    memory::pending_values<Allocator, value_type, sizeof...(Args)> values(
+        alloc, std::forward<Args>(args)...);
+    reserve(count + sizeof...(Args));
+    for (size_type i = 0; i != sizeof...(Args); ++i) {
+      emplace_back(std::move(values[i]));
+    }
+  }
+  // pushes each value to the front in turn, like list::insert_many_front,
+  // so the last argument ends up first
+  template <typename... Args>
+  void insert_many_front(Args &&...args) {
+    memory::pending_values<Allocator, value_type, sizeof...(Args)> values(
+        alloc, std::forward<Args>(args)...);
+    reserve(count + sizeof...(Args));
+    for (size_type i = 0; i != sizeof...(Args); ++i) {
+      emplace_front(std::move(values[i]));
+    }
+  }
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+  static constexpr size_type kInitialCapacity = 8;
+
+  T *buffer;
+  size_type head;
+  size_type count;
+  size_type allocd;
+  allocator_type alloc;
+
+  size_type mask() const noexcept { return allocd - 1; }
+  T *slot(size_type pos) const noexcept {
+    return buffer + ((head + pos) & mask());
+  }
+  // the next power of two from size, for sizes up to max_size(); stops
+  // doubling before it could wrap around
+  static size_type round_up(size_type size) noexcept {
+    size_type res = kInitialCapacity;
+    while (res < size && res <= std::numeric_limits<size_type>::max() / 2) {
+      res *= 2;
+    }
+    return res;
+  }
+  void null() noexcept {
+    buffer = nullptr;
+    head = 0;
+    count = 0;
+    allocd = 0;
+  }
+  void deallocate() noexcept {
+    if (buffer != nullptr) alloc_traits::deallocate(alloc, buffer, allocd);
+  }
+  // the elements from head to the block end, then the wrapped-around rest
+  size_type first_run() const noexcept {
+    return std::min(count, allocd - head);
+  }
+  void destroy_all() noexcept {
+    size_type first = first_run();
+    memory::destroy(alloc, buffer + head, buffer + head + first);
+    memory::destroy(alloc, buffer, buffer + (count - first));
+  }
+  void free_storage() noexcept {
+    destroy_all();
+    deallocate();
+    null();
+  }
+  // moves the elements, unwrapped, to the start of new_v; they stay put
+  // when a move throws
+  void move_into(T *new_v) {
+    size_type first = first_run();
+    memory::relocate_runs(alloc, buffer + head, first, new_v, buffer,
+                          count - first, new_v + first);
+  }
+  void reallocate(size_type new_allocd) {
+    T *new_v = alloc_traits::allocate(alloc, new_allocd);
+    try {
+      move_into(new_v);
+    } catch (...) {
+      alloc_traits::deallocate(alloc, new_v, new_allocd);
+      throw;
+    }
+    deallocate();
+    buffer = new_v;
+    head = 0;
+    allocd = new_allocd;
+  }
+  // Builds the new element in a block twice the size before the old
+  // elements are moved over, so args may still refer into the old block.
+  template <typename... Args>
+  void grow_and_construct(bool at_back, Args &&...args) {
+    size_type new_allocd = allocd == 0 ? kInitialCapacity : allocd * 2;
+    T *new_v = alloc_traits::allocate(alloc, new_allocd);
+    T *new_slot = at_back ? new_v + count : new_v + new_allocd - 1;
+    try {
+      alloc_traits::construct(alloc, new_slot, std::forward<Args>(args)...);
+      try {
+        move_into(new_v);
+      } catch (...) {
+        alloc_traits::destroy(alloc, new_slot);
+        throw;
+      }
+    } catch (...) {
+      alloc_traits::deallocate(alloc, new_v, new_allocd);
+      throw;
+    }
+    deallocate();
+    buffer = new_v;
+    head = at_back ? 0 : new_allocd - 1;
+    allocd = new_allocd;
+    ++count;
+  }
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_DEQUE_DEQUE_H_
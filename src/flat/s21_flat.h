@@ -0,0 +1,57 @@
+#ifndef S21_CONTAINERS_S21_FLAT_FLAT_H_
+#define S21_CONTAINERS_S21_FLAT_FLAT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+namespace flat {
+// Binary searches over a sorted array that do not branch on the keys: the
+// loop always runs log2(count) times and each step is a conditional move,
+// so a search costs no mispredictions, only the loads.
+template <typename T, typename K, typename Compare>
+std::size_t LowerIndex(const T *first, std::size_t count, const K &key,
+                       const Compare &comp) {
+  if (count == 0) return 0;
+  const T *base = first;
+  while (count > 1) {
+    std::size_t half = count / 2;
+    base = comp(base[half], key) ? base + half : base;
+    count -= half;
+  }
+  return (base - first) + (comp(*base, key) ? 1 : 0);
+}
+
+template <typename T, typename K, typename Compare>
+std::size_t UpperIndex(const T *first, std::size_t count, const K &key,
+                       const Compare &comp) {
+  if (count == 0) return 0;
+  const T *base = first;
+  while (count > 1) {
+    std::size_t half = count / 2;
+    base = comp(key, base[half]) ? base : base + half;
+    count -= half;
+  }
+  return (base - first) + (comp(key, *base) ? 0 : 1);
+}
+
+// Sorts [first, last) by key and drops every element whose key equals an
+// earlier one, so the first occurrence wins. Returns the new end. Input
+// that is already sorted is only checked.
+template <typename RandomIt, typename KeyOf, typename Compare>
+RandomIt SortUnique(RandomIt first, RandomIt last, KeyOf key_of,
+                    const Compare &comp) {
+  auto less = [&](const auto &a, const auto &b) {
+    return comp(key_of(a), key_of(b));
+  };
+  if (!std::is_sorted(first, last, less)) {
+    std::stable_sort(first, last, less);
+  }
+  return std::unique(first, last, [&](const auto &a, const auto &b) {
+    return !less(a, b);
+  });
+}
+}  // namespace flat
+
+#endif  // S21_CONTAINERS_S21_FLAT_FLAT_H_
@@ -0,0 +1,360 @@
+#ifndef S21_CONTAINERS_S21_FLAT_MAP_FLAT_MAP_H_
+#define S21_CONTAINERS_S21_FLAT_MAP_FLAT_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "../flat/s21_flat.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+// Ordered map kept as two parallel sorted s21::vectors, one of keys and
+// one of mapped values, so a binary search only touches keys and
+// iteration walks plain memory. A single insert or erase shifts the tail
+// of both; build the table with one bulk insert where possible. Inserting
+// or erasing invalidates iterators.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class flat_map {
+ public:
+  class FlatMapIterator;
+  class FlatMapConstIterator;
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = FlatMapIterator;
+  using const_iterator = FlatMapConstIterator;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  // flat_map member functions
+  flat_map() = default;
+  explicit flat_map(const Compare &comp) : comp_(comp) {}
+  flat_map(std::initializer_list<value_type> const &items) {
+    insert(items.begin(), items.end());
+  }
+  template <typename InputIt,
+            typename = decltype(*std::declval<InputIt &>())>
+  flat_map(InputIt first, InputIt last) {
+    insert(first, last);
+  }
+  flat_map(const flat_map &m) = default;
+  flat_map(flat_map &&m) noexcept = default;
+  ~flat_map() noexcept = default;
+  flat_map &operator=(const flat_map &m) = default;
+  flat_map &operator=(flat_map &&m) noexcept = default;
+
+  // flat_map element access
+  T &at(const Key &key) {
+    iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("No key in the flat_map");
+    }
+    return (*it).second;
+  }
+  const T &at(const Key &key) const {
+    const_iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("No key in the flat_map");
+    }
+    return (*it).second;
+  }
+  T &operator[](const Key &key) { return (*try_emplace(key).first).second; }
+  T &operator[](Key &&key) {
+    return (*try_emplace(std::move(key)).first).second;
+  }
+  // the sorted keys and their values, index for index
+  const vector<key_type> &keys() const noexcept { return keys_; }
+  const vector<mapped_type> &values() const noexcept { return values_; }
+
+  // flat_map iterators; an entry is handed out as a pair of references to
+  // its key and its value, which live in separate arrays
+  class FlatMapIterator {
+   public:
+    FlatMapIterator() noexcept = default;
+    FlatMapIterator(const key_type *key, mapped_type *value) noexcept
+        : key_(key), value_(value) {}
+    std::pair<const key_type &, mapped_type &> operator*() const noexcept {
+      return std::pair<const key_type &, mapped_type &>(*key_, *value_);
+    }
+    FlatMapIterator &operator++() noexcept {
+      ++key_;
+      ++value_;
+      return *this;
+    }
+    FlatMapIterator operator++(int) noexcept {
+      FlatMapIterator it(*this);
+      ++*this;
+      return it;
+    }
+    FlatMapIterator &operator--() noexcept {
+      --key_;
+      --value_;
+      return *this;
+    }
+    FlatMapIterator operator--(int) noexcept {
+      FlatMapIterator it(*this);
+      --*this;
+      return it;
+    }
+    bool operator==(const FlatMapIterator &other) const noexcept {
+      return key_ == other.key_;
+    }
+    bool operator!=(const FlatMapIterator &other) const noexcept {
+      return key_ != other.key_;
+    }
+
+   private:
+    friend class flat_map;
+    const key_type *key_ = nullptr;
+    mapped_type *value_ = nullptr;
+  };
+  class FlatMapConstIterator {
+   public:
+    FlatMapConstIterator() noexcept = default;
+    FlatMapConstIterator(const key_type *key,
+                         const mapped_type *value) noexcept
+        : key_(key), value_(value) {}
+    FlatMapConstIterator(const FlatMapIterator &other) noexcept
+        : key_(other.key_), value_(other.value_) {}
+    std::pair<const key_type &, const mapped_type &> operator*()
+        const noexcept {
+      return std::pair<const key_type &, const mapped_type &>(*key_, *value_);
+    }
+    FlatMapConstIterator &operator++() noexcept {
+      ++key_;
+      ++value_;
+      return *this;
+    }
+    FlatMapConstIterator operator++(int) noexcept {
+      FlatMapConstIterator it(*this);
+      ++*this;
+      return it;
+    }
+    FlatMapConstIterator &operator--() noexcept {
+      --key_;
+      --value_;
+      return *this;
+    }
+    FlatMapConstIterator operator--(int) noexcept {
+      FlatMapConstIterator it(*this);
+      --*this;
+      return it;
+    }
+    bool operator==(const FlatMapConstIterator &other) const noexcept {
+      return key_ == other.key_;
+    }
+    bool operator!=(const FlatMapConstIterator &other) const noexcept {
+      return key_ != other.key_;
+    }
+
+   private:
+    const key_type *key_ = nullptr;
+    const mapped_type *value_ = nullptr;
+  };
+
+  iterator begin() noexcept { return IteratorAt(0); }
+  iterator end() noexcept { return IteratorAt(size()); }
+  const_iterator begin() const noexcept { return IteratorAt(0); }
+  const_iterator end() const noexcept { return IteratorAt(size()); }
+
+  // flat_map capacity
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type max_size() const noexcept { return values_.max_size(); }
+  void reserve(size_type count) {
+    if (count > keys_.capacity()) {
+      keys_.reserve(count);
+      values_.reserve(count);
+    }
+  }
+  size_type capacity() const noexcept { return keys_.capacity(); }
+
+  // flat_map modifiers
+  void clear() noexcept {
+    keys_.clear();
+    values_.clear();
+  }
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return try_emplace(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return try_emplace(key, obj);
+  }
+  std::pair<iterator, bool> insert(Key &&key, T &&obj) {
+    return try_emplace(std::move(key), std::move(obj));
+  }
+  // Adds every entry of [first, last) whose key is not present yet; the
+  // first of several equal keys in the range wins. The batch is sorted on
+  // its own (a no-op for sorted input) and merged with the stored entries
+  // in one pass, O(n + m log m) instead of m shifts.
+  template <typename InputIt,
+            typename = decltype(*std::declval<InputIt &>())>
+  void insert(InputIt first, InputIt last) {
+    vector<std::pair<key_type, mapped_type>> batch;
+    for (; first != last; ++first) batch.push_back(*first);
+    std::pair<key_type, mapped_type> *batch_end =
+        flat::SortUnique(batch.begin(), batch.end(), KeyOf, comp_);
+    MergeIn(batch.begin(), batch_end);
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    std::pair<iterator, bool> p = try_emplace(key, obj);
+    if (!p.second) (*p.first).second = obj;
+    return p;
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    std::pair<key_type, mapped_type> value(std::forward<Args>(args)...);
+    return try_emplace(std::move(value.first), std::move(value.second));
+  }
+  // leaves args untouched when the key is already present
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args) {
+    return EmplaceAt(key, key, std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args) {
+    return EmplaceAt(key, std::move(key), std::forward<Args>(args)...);
+  }
+  void erase(iterator pos) noexcept {
+    size_type index = pos.key_ - keys_.data();
+    keys_.erase(keys_.begin() + index);
+    values_.erase(values_.begin() + index);
+  }
+  void erase(const key_type &key) {
+    iterator it = find(key);
+    if (it != end()) erase(it);
+  }
+  void swap(flat_map &other) noexcept {
+    keys_.swap(other.keys_);
+    values_.swap(other.values_);
+    std::swap(comp_, other.comp_);
+  }
+  // moves over the entries of other whose keys are not present yet
+  void merge(flat_map &other) {
+    if (&other == this) return;
+    vector<std::pair<key_type, mapped_type>> fresh;
+    flat_map rest(comp_);
+    for (size_type i = 0; i < other.size(); ++i) {
+      if (contains(other.keys_[i])) {
+        rest.keys_.push_back(std::move(other.keys_[i]));
+        rest.values_.push_back(std::move(other.values_[i]));
+      } else {
+        fresh.emplace_back(std::move(other.keys_[i]),
+                           std::move(other.values_[i]));
+      }
+    }
+    other.swap(rest);
+    MergeIn(fresh.begin(), fresh.end());
+  }
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+
+    res.reserve(sizeof...(args));
+    (res.push_back(emplace(std::forward<Args>(args))), ...);
+    return res;
+  }
+
+  // flat_map lookup
+  iterator find(const key_type &key) { return IteratorAt(FindIndex(key)); }
+  const_iterator find(const key_type &key) const {
+    return IteratorAt(FindIndex(key));
+  }
+  bool contains(const key_type &key) const { return FindIndex(key) != size(); }
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+  iterator lower_bound(const key_type &key) {
+    return IteratorAt(flat::LowerIndex(keys_.data(), size(), key, comp_));
+  }
+  iterator upper_bound(const key_type &key) {
+    return IteratorAt(flat::UpperIndex(keys_.data(), size(), key, comp_));
+  }
+
+  // flat_map observers
+  key_compare key_comp() const { return comp_; }
+
+ private:
+  static const key_type &KeyOf(
+      const std::pair<key_type, mapped_type> &entry) noexcept {
+    return entry.first;
+  }
+
+  iterator IteratorAt(size_type index) noexcept {
+    return iterator(keys_.data() + index, values_.data() + index);
+  }
+  const_iterator IteratorAt(size_type index) const noexcept {
+    return const_iterator(keys_.data() + index, values_.data() + index);
+  }
+
+  size_type FindIndex(const key_type &key) const {
+    size_type index = flat::LowerIndex(keys_.data(), size(), key, comp_);
+    if (index == size() || comp_(key, keys_[index])) return size();
+    return index;
+  }
+
+  // Inserts the entry built from key and args at its sorted place unless
+  // lookup_key is present. The value is built before the key goes in, so
+  // a throwing value constructor leaves both arrays as they were.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> EmplaceAt(const key_type &lookup_key, K &&key,
+                                      Args &&...args) {
+    size_type index =
+        flat::LowerIndex(keys_.data(), size(), lookup_key, comp_);
+    if (index != size() && !comp_(lookup_key, keys_[index])) {
+      return {IteratorAt(index), false};
+    }
+    values_.emplace(values_.begin() + index, std::forward<Args>(args)...);
+    try {
+      keys_.insert(keys_.begin() + index, std::forward<K>(key));
+    } catch (...) {
+      values_.erase(values_.begin() + index);
+      throw;
+    }
+    return {IteratorAt(index), true};
+  }
+
+  // Merges the sorted, duplicate-free batch [first, last) into the stored
+  // entries, skipping keys already present; the batch is moved from.
+  void MergeIn(std::pair<key_type, mapped_type> *first,
+               std::pair<key_type, mapped_type> *last) {
+    if (first == last) return;
+    vector<key_type> keys;
+    vector<mapped_type> values;
+    keys.reserve(size() + (last - first));
+    values.reserve(size() + (last - first));
+    size_type kept = 0;
+    while (kept != size() && first != last) {
+      if (comp_(first->first, keys_[kept])) {
+        keys.push_back(std::move(first->first));
+        values.push_back(std::move(first->second));
+        ++first;
+      } else {
+        if (!comp_(keys_[kept], first->first)) ++first;
+        keys.push_back(std::move_if_noexcept(keys_[kept]));
+        values.push_back(std::move_if_noexcept(values_[kept]));
+        ++kept;
+      }
+    }
+    for (; kept != size(); ++kept) {
+      keys.push_back(std::move_if_noexcept(keys_[kept]));
+      values.push_back(std::move_if_noexcept(values_[kept]));
+    }
+    for (; first != last; ++first) {
+      keys.push_back(std::move(first->first));
+      values.push_back(std::move(first->second));
+    }
+    keys_.swap(keys);
+    values_.swap(values);
+  }
+
+  vector<key_type> keys_;
+  vector<mapped_type> values_;
+  Compare comp_ = Compare();
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_FLAT_MAP_FLAT_MAP_H_
@@ -0,0 +1,181 @@
+#ifndef S21_CONTAINERS_S21_FLAT_SET_FLAT_SET_H_
+#define S21_CONTAINERS_S21_FLAT_SET_FLAT_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "../flat/s21_flat.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+// Ordered set kept as a sorted s21::vector: lookups are binary searches
+// over contiguous keys and iteration walks plain memory, while a single
+// insert or erase shifts the tail. Meant for tables built once, ideally
+// with one bulk insert, and then mostly read. Inserting or erasing
+// invalidates iterators.
+template <typename Key, typename Compare = std::less<Key>>
+class flat_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = const value_type *;
+  using const_iterator = const value_type *;
+  using size_type = size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+
+  // flat_set member functions
+  flat_set() = default;
+  explicit flat_set(const Compare &comp) : comp_(comp) {}
+  flat_set(std::initializer_list<value_type> const &items) {
+    insert(items.begin(), items.end());
+  }
+  template <typename InputIt,
+            typename = decltype(*std::declval<InputIt &>())>
+  flat_set(InputIt first, InputIt last) {
+    insert(first, last);
+  }
+  flat_set(const flat_set &s) = default;
+  flat_set(flat_set &&s) noexcept = default;
+  ~flat_set() noexcept = default;
+  flat_set &operator=(const flat_set &s) = default;
+  flat_set &operator=(flat_set &&s) noexcept = default;
+
+  // flat_set iterators
+  iterator begin() const noexcept { return keys_.begin(); }
+  iterator end() const noexcept { return keys_.end(); }
+
+  // flat_set capacity
+  bool empty() const noexcept { return keys_.empty(); }
+  size_type size() const noexcept { return keys_.size(); }
+  size_type max_size() const noexcept { return keys_.max_size(); }
+  void reserve(size_type count) {
+    if (count > keys_.capacity()) keys_.reserve(count);
+  }
+  size_type capacity() const noexcept { return keys_.capacity(); }
+
+  // flat_set modifiers
+  void clear() noexcept { keys_.clear(); }
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return EmplaceKey(value);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return EmplaceKey(std::move(value));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return EmplaceKey(value_type(std::forward<Args>(args)...));
+  }
+  // Adds every element of [first, last) whose key is not present yet: the
+  // batch is sorted on its own (a no-op for sorted input) and then merged
+  // with the stored keys in one pass, O(n + m log m) instead of m shifts.
+  template <typename InputIt,
+            typename = decltype(*std::declval<InputIt &>())>
+  void insert(InputIt first, InputIt last) {
+    vector<value_type> batch;
+    for (; first != last; ++first) batch.push_back(*first);
+    value_type *batch_end =
+        flat::SortUnique(batch.begin(), batch.end(), KeyOf, comp_);
+    MergeIn(batch.begin(), batch_end);
+  }
+  void erase(iterator pos) noexcept {
+    keys_.erase(keys_.begin() + (pos - keys_.begin()));
+  }
+  void erase(const key_type &key) {
+    iterator it = find(key);
+    if (it != end()) erase(it);
+  }
+  void swap(flat_set &other) noexcept {
+    keys_.swap(other.keys_);
+    std::swap(comp_, other.comp_);
+  }
+  // moves over the elements of other that are not present yet
+  void merge(flat_set &other) {
+    if (&other == this) return;
+    vector<value_type> fresh;
+    vector<value_type> rest;
+    for (value_type &value : other.keys_) {
+      if (contains(value)) {
+        rest.push_back(std::move(value));
+      } else {
+        fresh.push_back(std::move(value));
+      }
+    }
+    other.keys_.swap(rest);
+    MergeIn(fresh.begin(), fresh.end());
+  }
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+
+    res.reserve(sizeof...(args));
+    reserve(size() + sizeof...(args));
+    (res.push_back(insert(std::forward<Args>(args))), ...);
+    return res;
+  }
+
+  // flat_set lookup
+  iterator find(const key_type &key) const {
+    iterator it = lower_bound(key);
+    if (it == end() || comp_(key, *it)) return end();
+    return it;
+  }
+  bool contains(const key_type &key) const { return find(key) != end(); }
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+  iterator lower_bound(const key_type &key) const {
+    return begin() + flat::LowerIndex(begin(), size(), key, comp_);
+  }
+  iterator upper_bound(const key_type &key) const {
+    return begin() + flat::UpperIndex(begin(), size(), key, comp_);
+  }
+
+  // flat_set observers
+  key_compare key_comp() const { return comp_; }
+  value_compare value_comp() const { return comp_; }
+
+ private:
+  static const key_type &KeyOf(const value_type &value) noexcept {
+    return value;
+  }
+
+  template <typename K>
+  std::pair<iterator, bool> EmplaceKey(K &&key) {
+    size_type index = flat::LowerIndex(begin(), size(), key, comp_);
+    if (index != size() && !comp_(key, keys_[index])) {
+      return {begin() + index, false};
+    }
+    keys_.insert(keys_.begin() + index, std::forward<K>(key));
+    return {begin() + index, true};
+  }
+
+  // Merges the sorted, duplicate-free batch [first, last) into the stored
+  // keys, skipping keys already present; the batch is moved from.
+  void MergeIn(value_type *first, value_type *last) {
+    if (first == last) return;
+    vector<value_type> merged;
+    merged.reserve(size() + (last - first));
+    value_type *kept = keys_.begin();
+    while (kept != keys_.end() && first != last) {
+      if (comp_(*first, *kept)) {
+        merged.push_back(std::move(*first++));
+      } else {
+        if (!comp_(*kept, *first)) ++first;
+        merged.push_back(std::move_if_noexcept(*kept++));
+      }
+    }
+    for (; kept != keys_.end(); ++kept) {
+      merged.push_back(std::move_if_noexcept(*kept));
+    }
+    for (; first != last; ++first) merged.push_back(std::move(*first));
+    keys_.swap(merged);
+  }
+
+  vector<value_type> keys_;
+  Compare comp_ = Compare();
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_FLAT_SET_FLAT_SET_H_
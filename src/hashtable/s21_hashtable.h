@@ -0,0 +1,536 @@
+#ifndef S21_CONTAINERS_S21_HASHTABLE_HASHTABLE_H_
+#define S21_CONTAINERS_S21_HASHTABLE_HASHTABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "../memory/s21_memory.h"
+
+namespace hashtable {
+// One control byte per slot: kEmpty for a free slot, kSentinel for the end
+// of the table, or the low 7 bits of the hash (0..127) for a full slot.
+using ctrl_t = signed char;
+constexpr ctrl_t kEmpty = -128;
+constexpr ctrl_t kSentinel = -1;
+constexpr std::size_t kGroupWidth = 16;
+
+// Bit i is set when control byte i of a group matched.
+class BitMask {
+ public:
+  explicit BitMask(std::uint32_t mask) noexcept : mask_(mask) {}
+  explicit operator bool() const noexcept { return mask_ != 0; }
+  std::size_t Lowest() const noexcept { return __builtin_ctz(mask_); }
+  void ClearLowest() noexcept { mask_ &= mask_ - 1; }
+
+ private:
+  std::uint32_t mask_;
+};
+
+// kGroupWidth consecutive control bytes, compared in one go with SSE2 and
+// byte by byte on targets without it.
+class Group {
+ public:
+  explicit Group(const ctrl_t *pos) noexcept {
+#ifdef __SSE2__
+    ctrl_ = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+#else
+    std::memcpy(ctrl_, pos, kGroupWidth);
+#endif
+  }
+  BitMask Match(ctrl_t h2) const noexcept {
+#ifdef __SSE2__
+    return BitMask(static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_))));
+#else
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < kGroupWidth; ++i) {
+      if (ctrl_[i] == h2) mask |= 1u << i;
+    }
+    return BitMask(mask);
+#endif
+  }
+  BitMask MatchEmpty() const noexcept { return Match(kEmpty); }
+
+ private:
+#ifdef __SSE2__
+  __m128i ctrl_;
+#else
+  ctrl_t ctrl_[kGroupWidth];
+#endif
+};
+
+// Slot layouts. Map slots keep a mutable key so that rehashing and erase
+// can move entries; the containers only hand the key out as const.
+template <typename Key>
+struct SetPolicy {
+  using key_type = Key;
+  using slot_type = Key;
+  static const key_type &key(const slot_type &slot) noexcept { return slot; }
+};
+
+template <typename Key, typename T>
+struct MapPolicy {
+  using key_type = Key;
+  using slot_type = std::pair<Key, T>;
+  static const key_type &key(const slot_type &slot) noexcept {
+    return slot.first;
+  }
+};
+
+// Flat open-addressing table in the SwissTable layout: slots in one array,
+// their control bytes in another, and lookups compare a whole group of
+// control bytes against the 7-bit hash tag before touching any slot.
+//
+// Probing is linear, one group at a time. Every entry therefore sits after
+// an unbroken run of full slots starting at its home position, and erase
+// keeps that true by shifting later entries of the run back into the hole
+// (backward-shift deletion) instead of leaving tombstones behind.
+//
+// capacity_ is always 2^k - 1. ctrl_[capacity_] is a sentinel that ends
+// iteration and never matches, and the first kGroupWidth - 1 control bytes
+// are cloned after it, so a group can be loaded at any position and index
+// arithmetic simply wraps with & capacity_.
+template <typename Policy, typename Hash, typename KeyEqual>
+class HashTable {
+ public:
+  using key_type = typename Policy::key_type;
+  using slot_type = typename Policy::slot_type;
+  using size_type = std::size_t;
+
+  class Iterator {
+   public:
+    Iterator() noexcept : ctrl_(nullptr), slot_(nullptr) {}
+    Iterator(ctrl_t *ctrl, slot_type *slot) noexcept
+        : ctrl_(ctrl), slot_(slot) {}
+    slot_type &operator*() const noexcept { return *slot_; }
+    slot_type *operator->() const noexcept { return slot_; }
+    Iterator &operator++() noexcept {
+      ++ctrl_;
+      ++slot_;
+      SkipEmpty();
+      return *this;
+    }
+    Iterator operator++(int) noexcept {
+      Iterator it(*this);
+      ++*this;
+      return it;
+    }
+    bool operator==(const Iterator &other) const noexcept {
+      return ctrl_ == other.ctrl_;
+    }
+    bool operator!=(const Iterator &other) const noexcept {
+      return ctrl_ != other.ctrl_;
+    }
+    // the sentinel is not empty, so this always stops at the end
+    void SkipEmpty() noexcept {
+      while (*ctrl_ == kEmpty) {
+        ++ctrl_;
+        ++slot_;
+      }
+    }
+
+   private:
+    ctrl_t *ctrl_;
+    slot_type *slot_;
+  };
+
+  HashTable() noexcept = default;
+  explicit HashTable(size_type bucket_count, const Hash &hash = Hash(),
+                     const KeyEqual &eq = KeyEqual())
+      : hash_(hash), eq_(eq) {
+    if (bucket_count != 0) Resize(NormalizeCapacity(bucket_count));
+  }
+  HashTable(const HashTable &other)
+      : max_load_factor_(other.max_load_factor_),
+        hash_(other.hash_),
+        eq_(other.eq_) {
+    CopyFrom(other);
+  }
+  HashTable(HashTable &&other) noexcept
+      : max_load_factor_(other.max_load_factor_),
+        hash_(std::move(other.hash_)),
+        eq_(std::move(other.eq_)) {
+    StealFrom(other);
+  }
+  ~HashTable() noexcept { FreeStorage(); }
+  HashTable &operator=(const HashTable &other) {
+    if (this != &other) {
+      HashTable copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+  HashTable &operator=(HashTable &&other) noexcept {
+    if (this != &other) {
+      FreeStorage();
+      max_load_factor_ = other.max_load_factor_;
+      hash_ = std::move(other.hash_);
+      eq_ = std::move(other.eq_);
+      StealFrom(other);
+    }
+    return *this;
+  }
+
+  Iterator begin() const noexcept {
+    if (capacity_ == 0) return end();
+    Iterator it(ctrl_, slots_);
+    it.SkipEmpty();
+    return it;
+  }
+  Iterator end() const noexcept {
+    return Iterator(ctrl_ + capacity_, slots_ + capacity_);
+  }
+  Iterator IteratorAt(size_type index) const noexcept {
+    return Iterator(ctrl_ + index, slots_ + index);
+  }
+  size_type IndexOf(const Iterator &it) const noexcept {
+    return &*it - slots_;
+  }
+
+  size_type size() const noexcept { return size_; }
+  size_type max_size() const noexcept {
+    return (SIZE_MAX / 2) / (sizeof(slot_type) + 1);
+  }
+  size_type bucket_count() const noexcept { return capacity_; }
+  float load_factor() const noexcept {
+    return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / capacity_;
+  }
+  float max_load_factor() const noexcept { return max_load_factor_; }
+  void max_load_factor(float ml) {
+    if (!(ml > 0.0f && ml < 1.0f)) {
+      throw std::invalid_argument("max_load_factor must be in (0, 1)");
+    }
+    max_load_factor_ = ml;
+    if (capacity_ != 0) {
+      max_elements_ = MaxElements(capacity_);
+      if (size_ > max_elements_) Resize(CapacityFor(size_));
+    }
+  }
+  void reserve(size_type count) {
+    if (count > max_elements_) Resize(CapacityFor(count));
+  }
+  void rehash(size_type count) {
+    if (count == 0 && size_ == 0) {
+      FreeStorage();
+      return;
+    }
+    size_type capacity = NormalizeCapacity(count);
+    size_type needed = CapacityFor(size_);
+    if (capacity < needed) capacity = needed;
+    if (capacity != capacity_) Resize(capacity);
+  }
+  const Hash &hash_function() const noexcept { return hash_; }
+  const KeyEqual &key_eq() const noexcept { return eq_; }
+
+  void clear() noexcept {
+    if (capacity_ == 0) return;
+    DestroySlots();
+    ResetCtrl(ctrl_, capacity_);
+    size_ = 0;
+  }
+
+  template <typename K>
+  Iterator find(const K &key) const {
+    return IteratorAt(FindIndex(key, HashOf(key)));
+  }
+
+  // Inserts an entry built from args unless key is already present; args
+  // are only used when the insertion happens. Returns the entry and
+  // whether it was inserted.
+  template <typename K, typename... Args>
+  std::pair<Iterator, bool> try_emplace(const K &key, Args &&...args) {
+    size_type hash = HashOf(key);
+    size_type index = FindIndex(key, hash);
+    if (index != capacity_) return {IteratorAt(index), false};
+    if (size_ >= max_elements_) {
+      // args may refer into the table, so build the entry before moving it
+      slot_type slot(std::forward<Args>(args)...);
+      Resize(CapacityFor(size_ + 1));
+      index = FindFree(ctrl_, capacity_, hash);
+      alloc_traits::construct(alloc_, slots_ + index, std::move(slot));
+    } else {
+      index = FindFree(ctrl_, capacity_, hash);
+      alloc_traits::construct(alloc_, slots_ + index,
+                              std::forward<Args>(args)...);
+    }
+    SetCtrl(index, H2(hash));
+    ++size_;
+    return {IteratorAt(index), true};
+  }
+
+  void erase(Iterator pos) { EraseAt(IndexOf(pos)); }
+  size_type erase(const key_type &key) {
+    size_type index = FindIndex(key, HashOf(key));
+    if (index == capacity_) return 0;
+    EraseAt(index);
+    return 1;
+  }
+
+  // Moves over every entry of other whose key is not present here yet.
+  void merge(HashTable &other) {
+    if (&other == this) return;
+    size_type index = 0;
+    while (index < other.capacity_) {
+      if (other.ctrl_[index] != kEmpty) {
+        slot_type &slot = other.slots_[index];
+        if (try_emplace(Policy::key(slot), std::move(slot)).second) {
+          // a later entry of the run may have been shifted into index
+          other.EraseAt(index);
+          continue;
+        }
+      }
+      ++index;
+    }
+  }
+
+  void swap(HashTable &other) noexcept {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(max_elements_, other.max_elements_);
+    std::swap(max_load_factor_, other.max_load_factor_);
+    std::swap(hash_, other.hash_);
+    std::swap(eq_, other.eq_);
+  }
+
+ private:
+  using slot_allocator = std::allocator<slot_type>;
+  using alloc_traits = std::allocator_traits<slot_allocator>;
+
+  // std::hash of an integer is often the identity, so the bits are mixed
+  // before being split into the home position (H1) and the 7-bit tag (H2).
+  template <typename K>
+  size_type HashOf(const K &key) const {
+    std::uint64_t h = hash_(key);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<size_type>(h);
+  }
+  static size_type H1(size_type hash) noexcept { return hash >> 7; }
+  static ctrl_t H2(size_type hash) noexcept {
+    return static_cast<ctrl_t>(hash & 0x7F);
+  }
+
+  // Returns the index of key or capacity_ when it is absent.
+  template <typename K>
+  size_type FindIndex(const K &key, size_type hash) const {
+    if (size_ == 0) return capacity_;
+    ctrl_t h2 = H2(hash);
+    size_type pos = H1(hash) & capacity_;
+    while (true) {
+      Group group(ctrl_ + pos);
+      for (BitMask match = group.Match(h2); match; match.ClearLowest()) {
+        size_type index = (pos + match.Lowest()) & capacity_;
+        if (eq_(key, Policy::key(slots_[index]))) return index;
+      }
+      if (group.MatchEmpty()) return capacity_;
+      pos = (pos + kGroupWidth) & capacity_;
+    }
+  }
+
+  // First free slot of the run starting at the home position of hash.
+  static size_type FindFree(const ctrl_t *ctrl, size_type capacity,
+                            size_type hash) noexcept {
+    size_type pos = H1(hash) & capacity;
+    while (true) {
+      BitMask empty = Group(ctrl + pos).MatchEmpty();
+      if (empty) return (pos + empty.Lowest()) & capacity;
+      pos = (pos + kGroupWidth) & capacity;
+    }
+  }
+
+  void SetCtrl(size_type index, ctrl_t value) noexcept {
+    SetCtrl(ctrl_, capacity_, index, value);
+  }
+  static void SetCtrl(ctrl_t *ctrl, size_type capacity, size_type index,
+                      ctrl_t value) noexcept {
+    ctrl[index] = value;
+    if (index < kGroupWidth - 1) ctrl[capacity + 1 + index] = value;
+  }
+  static void ResetCtrl(ctrl_t *ctrl, size_type capacity) noexcept {
+    std::memset(ctrl, kEmpty, capacity + kGroupWidth);
+    ctrl[capacity] = kSentinel;
+  }
+
+  // Erases the entry at index and closes the hole: each later entry of the
+  // run moves back into it if that is still at or after its home position.
+  // The sentinel counts as a full slot that never moves. Closing the hole
+  // calls Hash and may copy an entry whose move can throw; if either
+  // throws, the entry is still erased and every other entry stays owned
+  // and iterable, but lookups may miss the rest of its run until the table
+  // is next resized.
+  void EraseAt(size_type index) {
+    alloc_traits::destroy(alloc_, slots_ + index);
+    size_type hole = index;
+    try {
+      for (size_type next = (index + 1) & capacity_; ctrl_[next] != kEmpty;
+           next = (next + 1) & capacity_) {
+        if (next == capacity_) continue;
+        size_type home = H1(HashOf(Policy::key(slots_[next]))) & capacity_;
+        if (((hole - home) & capacity_) < ((next - home) & capacity_)) {
+          s21::memory::relocate(alloc_, slots_ + next, 1, slots_ + hole);
+          SetCtrl(hole, ctrl_[next]);
+          hole = next;
+        }
+      }
+    } catch (...) {
+      SetCtrl(hole, kEmpty);
+      --size_;
+      throw;
+    }
+    SetCtrl(hole, kEmpty);
+    --size_;
+  }
+
+  size_type MaxElements(size_type capacity) const noexcept {
+    size_type max = static_cast<size_type>(capacity * max_load_factor_);
+    return max < capacity ? max : capacity - 1;
+  }
+  // smallest 2^k - 1 of at least count, and at least one group
+  static size_type NormalizeCapacity(size_type count) noexcept {
+    size_type capacity = kGroupWidth - 1;
+    while (capacity < count) capacity = capacity * 2 + 1;
+    return capacity;
+  }
+  size_type CapacityFor(size_type count) const noexcept {
+    size_type capacity =
+        NormalizeCapacity(static_cast<size_type>(count / max_load_factor_));
+    while (MaxElements(capacity) < count) capacity = capacity * 2 + 1;
+    return capacity;
+  }
+
+  // Rebuilds the table with new_capacity slots. Entries are copied rather
+  // than moved when their move may throw, so a failure leaves the table
+  // as it was.
+  void Resize(size_type new_capacity) {
+    ctrl_t *new_ctrl = AllocateCtrl(new_capacity);
+    slot_type *new_slots = nullptr;
+    try {
+      new_slots = alloc_traits::allocate(alloc_, new_capacity);
+    } catch (...) {
+      DeallocateCtrl(new_ctrl, new_capacity);
+      throw;
+    }
+    ResetCtrl(new_ctrl, new_capacity);
+    size_type moved = 0;
+    try {
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (ctrl_[i] == kEmpty) continue;
+        size_type hash = HashOf(Policy::key(slots_[i]));
+        size_type index = FindFree(new_ctrl, new_capacity, hash);
+        if constexpr (s21::is_trivially_relocatable<slot_type>::value) {
+          std::memcpy(static_cast<void *>(new_slots + index),
+                      static_cast<void *>(slots_ + i), sizeof(slot_type));
+        } else {
+          alloc_traits::construct(alloc_, new_slots + index,
+                                  std::move_if_noexcept(slots_[i]));
+        }
+        SetCtrl(new_ctrl, new_capacity, index, H2(hash));
+        ++moved;
+      }
+    } catch (...) {
+      for (size_type i = 0; moved != 0 && i < new_capacity; ++i) {
+        if (new_ctrl[i] != kEmpty) {
+          alloc_traits::destroy(alloc_, new_slots + i);
+          --moved;
+        }
+      }
+      alloc_traits::deallocate(alloc_, new_slots, new_capacity);
+      DeallocateCtrl(new_ctrl, new_capacity);
+      throw;
+    }
+    if constexpr (!s21::is_trivially_relocatable<slot_type>::value) {
+      DestroySlots();
+    }
+    DeallocateStorage();
+    ctrl_ = new_ctrl;
+    slots_ = new_slots;
+    capacity_ = new_capacity;
+    max_elements_ = MaxElements(new_capacity);
+  }
+
+  // Same capacity and hash function, so every entry keeps its index.
+  void CopyFrom(const HashTable &other) {
+    if (other.size_ == 0) return;
+    Resize(other.capacity_);
+    size_type copied = 0;
+    try {
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (other.ctrl_[i] == kEmpty) continue;
+        alloc_traits::construct(alloc_, slots_ + i, other.slots_[i]);
+        SetCtrl(i, other.ctrl_[i]);
+        ++copied;
+      }
+    } catch (...) {
+      size_ = copied;
+      FreeStorage();
+      throw;
+    }
+    size_ = other.size_;
+  }
+  void StealFrom(HashTable &other) noexcept {
+    ctrl_ = other.ctrl_;
+    slots_ = other.slots_;
+    capacity_ = other.capacity_;
+    size_ = other.size_;
+    max_elements_ = other.max_elements_;
+    other.ctrl_ = nullptr;
+    other.slots_ = nullptr;
+    other.capacity_ = 0;
+    other.size_ = 0;
+    other.max_elements_ = 0;
+  }
+
+  static ctrl_t *AllocateCtrl(size_type capacity) {
+    return std::allocator<ctrl_t>().allocate(capacity + kGroupWidth);
+  }
+  static void DeallocateCtrl(ctrl_t *ctrl, size_type capacity) noexcept {
+    std::allocator<ctrl_t>().deallocate(ctrl, capacity + kGroupWidth);
+  }
+  void DestroySlots() noexcept {
+    if constexpr (!std::is_trivially_destructible<slot_type>::value) {
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (ctrl_[i] != kEmpty) alloc_traits::destroy(alloc_, slots_ + i);
+      }
+    }
+  }
+  void DeallocateStorage() noexcept {
+    if (capacity_ == 0) return;
+    alloc_traits::deallocate(alloc_, slots_, capacity_);
+    DeallocateCtrl(ctrl_, capacity_);
+  }
+  void FreeStorage() noexcept {
+    if (capacity_ == 0) return;
+    DestroySlots();
+    DeallocateStorage();
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    max_elements_ = 0;
+  }
+
+  ctrl_t *ctrl_ = nullptr;
+  slot_type *slots_ = nullptr;
+  size_type capacity_ = 0;
+  size_type size_ = 0;
+  size_type max_elements_ = 0;
+  float max_load_factor_ = 0.875f;
+  Hash hash_;
+  KeyEqual eq_;
+  slot_allocator alloc_;
+};
+}  // namespace hashtable
+
+#endif  // S21_CONTAINERS_S21_HASHTABLE_HASHTABLE_H_
@@ -1,9 +1,13 @@
 #ifndef S21_CONTAINERS_S21_LIST_H_
 #define S21_CONTAINERS_S21_LIST_H_
 
+#include <climits>
+#include <functional>
 #include <limits>
 #include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
 
@@ -30,12 +34,20 @@ class list {
   size_type max_size() const noexcept;
   void clear() noexcept;
   void push_back(const_reference value);
+  void push_back(value_type &&value);
   void pop_back() noexcept;
   void push_front(const_reference value);
+  void push_front(value_type &&value);
   void pop_front() noexcept;
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+  template <class... Args>
+  reference emplace_front(Args &&...args);
   void swap(list &other) noexcept;
   void reverse() noexcept;
-  void sort() noexcept;
+  void sort();
+  template <class Compare>
+  void sort(Compare comp);
 
  private:
   void MoveList(list &&l);
@@ -45,8 +57,21 @@ class list {
     value_type value;
     Node *next;
     Node *prev;
-    Node(const_reference value) : value(value), next(nullptr), prev(nullptr){};
+    template <class... Args>
+    explicit Node(Args &&...args)
+        : value(std::forward<Args>(args)...), next(nullptr), prev(nullptr){};
   };
+  template <class Compare>
+  static void MergeChains(Node *&first, Node *second, Compare &comp);
+  void RelinkChain(Node *head) noexcept;
+  void UnlinkRange(Node *first, Node *last, size_type count) noexcept;
+  void LinkRange(Node *pos, Node *first, Node *last, size_type count) noexcept;
+  void SyncEnd() noexcept;
+  // what front(), back() and dereferencing a null const_iterator return
+  static const_reference Zero() noexcept {
+    static const value_type zero = value_type();
+    return zero;
+  }
   Node *topHead;
   Node *topTail;
   Node *topEnd;
@@ -90,6 +115,8 @@ class list {
     ~ListIterator() = default;
     ListIterator &operator=(const ConstListIterator &other) noexcept;
     ListIterator operator=(ConstListIterator &&other) noexcept;
+    // like std::list, the iterator must point at an element; there is no
+    // fallback to write through for an empty list
     reference operator*() const noexcept;
     ListIterator operator++() noexcept;
     ListIterator operator--() noexcept;
@@ -103,10 +130,18 @@ class list {
   iterator begin();
   iterator end();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
   void erase(iterator pos);
-  void splice(const_iterator pos, list &other);
+  void splice(const_iterator pos, list &other) noexcept;
+  void splice(const_iterator pos, list &other, const_iterator it) noexcept;
+  void splice(const_iterator pos, list &other, const_iterator first,
+              const_iterator last) noexcept;
   void unique();
   void merge(list &other);
+  template <class Compare>
+  void merge(list &other, Compare comp);
 
   template <class... Args>
   iterator insert_many(const_iterator pos, Args &&...args);
@@ -10,7 +10,7 @@ template <typename T>
 list<T>::list(size_type n) : list() {
   if (n < max_size()) {
     for (size_type i = 0; i < n; ++i) {
-      push_back(value_type());
+      emplace_back();
     }
   }
 }
@@ -57,14 +57,12 @@ list<T> list<T>::operator=(list &&l) noexcept {
 
 template <typename T>
 typename list<T>::const_reference list<T>::front() const noexcept {
-  const_reference zero = value_type();
-  return empty() ? zero : topHead->value;
+  return empty() ? Zero() : topHead->value;
 }
 
 template <typename T>
 typename list<T>::const_reference list<T>::back() const noexcept {
-  const_reference zero = value_type();
-  return empty() ? zero : topTail->value;
+  return empty() ? Zero() : topTail->value;
 }
 
 template <typename T>
@@ -111,16 +109,28 @@ void list<T>::clear() noexcept {
 template <typename T>
 typename list<T>::iterator list<T>::insert(iterator pos,
                                            const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T>
+typename list<T>::iterator list<T>::insert(iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T>
+template <class... Args>
+typename list<T>::iterator list<T>::emplace(const_iterator pos,
+                                            Args &&...args) {
   if (pos == topHead) {
-    push_front(value);
+    emplace_front(std::forward<Args>(args)...);
     pos.itr_ = topHead;
   } else if (pos == end()) {
-    push_back(value);
+    emplace_back(std::forward<Args>(args)...);
     pos.itr_ = topTail;
   } else {
     Node *temp = nullptr;
     try {
-      temp = new Node(value);
+      temp = new Node(std::forward<Args>(args)...);
     } catch (const std::bad_alloc &e) {
       clear();
       throw e;
@@ -140,10 +150,9 @@ typename list<T>::iterator list<T>::insert(iterator pos,
       itr->prev = temp;
     }
     ++size_;
-    topEnd->value++;
-    pos = iterator(temp);
+    pos.itr_ = temp;
   }
-  return pos;
+  return iterator(pos);
 }
 
 template <typename T>
@@ -165,9 +174,20 @@ void list<T>::erase(iterator pos) {
 
 template <typename T>
 void list<T>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T>
+void list<T>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T>
+template <class... Args>
+typename list<T>::reference list<T>::emplace_back(Args &&...args) {
   Node *temp = nullptr;
   try {
-    temp = new Node(value);
+    temp = new Node(std::forward<Args>(args)...);
   } catch (const std::bad_alloc &e) {
     clear();
     throw e;
@@ -184,6 +204,7 @@ void list<T>::push_back(const_reference value) {
     }
   }
   ++size_;
+  return temp->value;
 }
 
 template <typename T>
@@ -205,9 +226,20 @@ void list<T>::pop_back() noexcept {
 
 template <typename T>
 void list<T>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T>
+void list<T>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T>
+template <class... Args>
+typename list<T>::reference list<T>::emplace_front(Args &&...args) {
   Node *temp = nullptr;
   try {
-    temp = new Node(value);
+    temp = new Node(std::forward<Args>(args)...);
   } catch (const std::bad_alloc &e) {
     clear();
     throw e;
@@ -224,6 +256,7 @@ void list<T>::push_front(const_reference value) {
     topHead = temp;
   }
   ++size_;
+  return temp->value;
 }
 
 template <typename T>
@@ -253,37 +286,75 @@ void list<T>::swap(list &other) noexcept {
 
 template <typename T>
 void list<T>::merge(list &other) {
-  if (empty() && !other.empty()) {
-    CopyList(other);
-  } else if (!empty() && !other.empty()) {
-    iterator it = begin();
-    iterator it_other = other.begin();
-    while (it != end() && it_other != other.end()) {
-      if (it.itr_->value >= it_other.itr_->value) {
-        insert(it, it_other.itr_->value);
-        ++it_other;
-      } else {
-        ++it;
-      }
-    }
-    while (it_other != other.end()) {
-      insert(it, it_other.itr_->value);
-      ++it_other;
+  merge(other, std::less<value_type>());
+}
+
+// Moves the nodes of other into place one by one; on equal elements the
+// ones already in this list stay first. Nothing is allocated or copied.
+template <typename T>
+template <class Compare>
+void list<T>::merge(list &other, Compare comp) {
+  if (&other == this) return;
+  Node *pos = topHead;
+  Node *node = other.topHead;
+  while (node != nullptr) {
+    if (pos == nullptr) {
+      Node *last = other.topTail;
+      size_type count = other.size_;
+      other.UnlinkRange(node, last, count);
+      LinkRange(nullptr, node, last, count);
+      node = nullptr;
+    } else if (comp(node->value, pos->value)) {
+      Node *next = node->next;
+      other.UnlinkRange(node, node, 1);
+      LinkRange(pos, node, node, 1);
+      node = next;
+    } else {
+      pos = pos->next;
     }
   }
-  other.clear();
 }
 
 template <typename T>
-void list<T>::splice(const_iterator pos, list &other) {
-  if (!other.empty()) {
-    iterator our_it;
-    our_it.itr_ = pos.itr_;
-    for (iterator it = other.begin(); it != other.end(); ++it) {
-      insert(our_it, *it);
+void list<T>::splice(const_iterator pos, list &other) noexcept {
+  if (&other != this && !other.empty()) {
+    Node *first = other.topHead;
+    Node *last = other.topTail;
+    size_type count = other.size_;
+    other.UnlinkRange(first, last, count);
+    LinkRange(pos.itr_, first, last, count);
+  }
+}
+
+template <typename T>
+void list<T>::splice(const_iterator pos, list &other,
+                     const_iterator it) noexcept {
+  Node *node = it.itr_;
+  if (node != nullptr && node != other.topEnd && node != pos.itr_) {
+    other.UnlinkRange(node, node, 1);
+    LinkRange(pos.itr_, node, node, 1);
+  }
+}
+
+// Moves [first, last) of other before pos. Only a splice between two
+// different lists has to walk the range, to keep both sizes right.
+template <typename T>
+void list<T>::splice(const_iterator pos, list &other, const_iterator first,
+                     const_iterator last) noexcept {
+  if (first == last) return;
+  Node *first_node = first.itr_;
+  Node *last_node = last.itr_ == nullptr || last.itr_ == other.topEnd
+                        ? other.topTail
+                        : last.itr_->prev;
+  size_type count = 0;
+  if (&other != this) {
+    for (Node *node = first_node; node != last_node; node = node->next) {
+      ++count;
     }
-    other.clear();
+    ++count;
   }
+  other.UnlinkRange(first_node, last_node, count);
+  LinkRange(pos.itr_, first_node, last_node, count);
 }
 
 template <typename T>
@@ -315,18 +386,64 @@ void list<T>::unique() {
 };
 
 template <typename T>
-void list<T>::sort() noexcept {
-  for (size_type i = 0; i < size_ - 1; ++i) {
-    Node *node = topHead;
-    for (size_type j = 0; j < size_ - i - 1; ++j) {
-      if (node->value >= node->next->value) {
-        T temp = node->value;
-        node->value = node->next->value;
-        node->next->value = temp;
+void list<T>::sort() {
+  sort(std::less<value_type>());
+}
+
+// Bottom-up merge sort on the next links only: bins[i] holds a sorted run
+// of 2^i nodes, and every new node is carried up through the occupied bins
+// like a binary counter. Runs from lower bins are later in the list, so
+// they are always merged in as the second operand to keep the sort stable.
+// If comp throws, every node is relinked in some order before rethrowing.
+template <typename T>
+template <class Compare>
+void list<T>::sort(Compare comp) {
+  if (size_ < 2) return;
+  const size_type kBins = sizeof(size_type) * CHAR_BIT + 1;
+  Node *bins[kBins] = {};
+  Node *rest = topHead;
+  Node *carry = nullptr;
+  Node *sorted = nullptr;
+  try {
+    while (rest != nullptr) {
+      carry = rest;
+      rest = rest->next;
+      carry->next = nullptr;
+      size_type i = 0;
+      for (; bins[i] != nullptr; ++i) {
+        Node *incoming = carry;
+        carry = nullptr;
+        MergeChains(bins[i], incoming, comp);
+        carry = bins[i];
+        bins[i] = nullptr;
       }
-      node = node->next;
+      bins[i] = carry;
+      carry = nullptr;
     }
+    for (size_type i = 0; i < kBins; ++i) {
+      if (bins[i] != nullptr) {
+        Node *incoming = sorted;
+        sorted = nullptr;
+        MergeChains(bins[i], incoming, comp);
+        sorted = bins[i];
+        bins[i] = nullptr;
+      }
+    }
+  } catch (...) {
+    Node *head = nullptr;
+    Node **link = &head;
+    for (Node *chain : {rest, carry, sorted}) {
+      *link = chain;
+      while (*link != nullptr) link = &(*link)->next;
+    }
+    for (Node *chain : bins) {
+      *link = chain;
+      while (*link != nullptr) link = &(*link)->next;
+    }
+    RelinkChain(head);
+    throw;
   }
+  RelinkChain(sorted);
 }
 
 template <typename T>
@@ -348,12 +465,107 @@ void list<T>::CopyList(const list &l) {
   }
 }
 
+// Merges the null-terminated next chain second into first, taking from
+// first on ties. On a throwing comp both chains end up in first, unordered.
+template <typename T>
+template <class Compare>
+void list<T>::MergeChains(Node *&first, Node *second, Compare &comp) {
+  Node *head = nullptr;
+  Node **link = &head;
+  Node *other = first;
+  try {
+    while (other != nullptr && second != nullptr) {
+      if (comp(second->value, other->value)) {
+        *link = second;
+        second = second->next;
+      } else {
+        *link = other;
+        other = other->next;
+      }
+      link = &(*link)->next;
+    }
+  } catch (...) {
+    *link = other;
+    while (*link != nullptr) link = &(*link)->next;
+    *link = second;
+    first = head;
+    throw;
+  }
+  *link = other != nullptr ? other : second;
+  first = head;
+}
+
+// Rebuilds the prev links, head and tail from a null-terminated next chain
+// holding all size_ nodes.
+template <typename T>
+void list<T>::RelinkChain(Node *head) noexcept {
+  Node *prev = nullptr;
+  for (Node *node = head; node != nullptr; node = node->next) {
+    node->prev = prev;
+    prev = node;
+  }
+  topHead = head;
+  topTail = prev;
+  SyncEnd();
+}
+
+// Detaches the count nodes [first, last] from this list.
+template <typename T>
+void list<T>::UnlinkRange(Node *first, Node *last, size_type count) noexcept {
+  if (first->prev != nullptr) {
+    first->prev->next = last->next;
+  } else {
+    topHead = last->next;
+  }
+  if (last->next != nullptr) {
+    last->next->prev = first->prev;
+  } else {
+    topTail = first->prev;
+  }
+  first->prev = nullptr;
+  last->next = nullptr;
+  size_ -= count;
+  SyncEnd();
+}
+
+// Links the detached chain [first, last] in front of pos, where nullptr or
+// the end sentinel stand for end().
+template <typename T>
+void list<T>::LinkRange(Node *pos, Node *first, Node *last,
+                        size_type count) noexcept {
+  if (pos == topEnd) pos = nullptr;
+  Node *prev = pos != nullptr ? pos->prev : topTail;
+  first->prev = prev;
+  last->next = pos;
+  if (prev != nullptr) {
+    prev->next = first;
+  } else {
+    topHead = first;
+  }
+  if (pos != nullptr) {
+    pos->prev = last;
+  } else {
+    topTail = last;
+  }
+  size_ += count;
+  SyncEnd();
+}
+
+template <typename T>
+void list<T>::SyncEnd() noexcept {
+  if (topEnd != nullptr) {
+    topEnd->prev = topTail;
+    topEnd->next = topHead;
+  }
+}
+
 template <typename T>
 void list<T>::CreateEnd() {
   try {
     topEnd = new Node(value_type());
     topEnd->prev = topTail;
-    topEnd->value = size_;
+    // the size marker only makes sense for arithmetic element types
+    if constexpr (std::is_arithmetic<value_type>::value) topEnd->value = size_;
     topEnd->next = topHead;
   } catch (const std::bad_alloc &e) {
     clear();
@@ -408,8 +620,7 @@ typename list<T>::const_iterator list<T>::const_iterator::operator=(
 template <typename T>
 typename list<T>::const_reference list<T>::const_iterator::operator*()
     const noexcept {
-  value_type zero = value_type();
-  return itr_ == nullptr ? zero : itr_->value;
+  return itr_ == nullptr ? Zero() : itr_->value;
 }
 
 template <typename T>
@@ -478,8 +689,7 @@ typename list<T>::iterator list<T>::iterator::operator=(
 
 template <typename T>
 typename list<T>::reference list<T>::iterator::operator*() const noexcept {
-  value_type zero = value_type();
-  return this->itr_ == nullptr ? zero : this->itr_->value;
+  return this->itr_->value;
 }
 
 template <typename T>
@@ -532,26 +742,20 @@ typename list<T>::iterator list<T>::insert_many(const_iterator pos,
                                                 Args &&...args) {
   iterator it;
   it.itr_ = pos.itr_;
-  for (auto &i : {args...}) {
-    insert(it, i);
-  }
+  (emplace(it, std::forward<Args>(args)), ...);
   return it;
 }
 
 template <class T>
 template <class... Args>
 void list<T>::insert_many_back(Args &&...args) {
-  for (auto &i : {args...}) {
-    push_back(i);
-  }
+  (emplace_back(std::forward<Args>(args)), ...);
 }
 
 template <class T>
 template <class... Args>
 void list<T>::insert_many_front(Args &&...args) {
-  for (auto &i : {args...}) {
-    push_front(i);
-  }
+  (emplace_front(std::forward<Args>(args)), ...);
 }
 
 }  // namespace s21
\ No newline at end of file
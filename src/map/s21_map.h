@@ -1,6 +1,7 @@
 #ifndef S21_CONTAINERS_S21_MAP_MAP_H_
 #define S21_CONTAINERS_S21_MAP_MAP_H_
 
+#include <functional>
 #include <stdexcept>
 
 #include "../rbtree/s21_rbtree.h"
@@ -9,8 +10,14 @@
 namespace s21 {
 using namespace rbtree;
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          bool OrderStatistics = false>
 class map {
+  using tree_type = RBTree<Key, T, Compare, OrderStatistics>;
+
+  template <typename C>
+  using if_transparent = typename C::is_transparent;
+
  public:
   class MapIterator;
   class MapConstIterator;
@@ -22,13 +29,22 @@ class map {
   using iterator = MapIterator;
   using const_iterator = MapConstIterator;
   using size_type = size_t;
+  using key_compare = Compare;
+  using node_type = typename tree_type::node_handle;
+  using node_pool = typename tree_type::pool_type;
 
   // map member functions
   map() noexcept : rb() {}
+  explicit map(const Compare &comp) : rb(comp) {}
+  explicit map(std::shared_ptr<node_pool> pool) noexcept
+      : rb(std::move(pool)) {}
   map(std::initializer_list<value_type> const &items) {
-    for (auto it : items) {
-      insert(it);
-    }
+    assign_sorted(items.begin(), items.end());
+  }
+  template <typename InputIt,
+            typename = decltype(*std::declval<InputIt &>())>
+  map(InputIt first, InputIt last) {
+    assign_sorted(first, last);
   }
   map(const map &m) { *this = m; }
   map(map &&m) noexcept { *this = std::move(m); }
@@ -54,26 +70,23 @@ class map {
     if (it == end()) {
       throw std::out_of_range("No key in the map");
     } else {
-      return (*it).second;
+      return it->value_;
     }
   }
-  T &operator[](const Key &key) {
-    if (contains(key)) {
-      return *(rb.find(key));
-    } else {
-      std::pair<iterator, bool> p = insert(key, mapped_type());
-      return (*(p.first)).second;
-    }
+  // a single descent finds the key or the leaf where it gets inserted
+  T &operator[](const Key &key) { return rb.try_emplace(key).first->value_; }
+  T &operator[](Key &&key) {
+    return rb.try_emplace(std::move(key)).first->value_;
   }
 
   // map iterators
   iterator begin() noexcept { return rb.begin(); }
   iterator end() noexcept { return rb.end(); }
 
-  class MapIterator : public TreeIterator<Key, T> {
+  class MapIterator : public TreeIterator<Key, T, OrderStatistics> {
    public:
-    using TreeIterator<Key, T>::TreeIterator;
-    MapIterator(const TreeIterator<Key, T> &other)
+    using TreeIterator<Key, T, OrderStatistics>::TreeIterator;
+    MapIterator(const TreeIterator<Key, T, OrderStatistics> &other)
         : MapIterator(other.current_, other.end_) {}
     std::pair<key_type, mapped_type &> operator*() const noexcept {
       return std::pair<key_type, mapped_type &>(this->current_->key_,
@@ -87,8 +100,14 @@ class map {
       MapIterator it(*this);
       return it.MoveIterator(rhs, false);
     }
-    MapIterator &operator++() noexcept { return *this += 1; }
-    MapIterator &operator--() noexcept { return *this -= 1; }
+    MapIterator &operator++() noexcept {
+      this->template Step<true>();
+      return *this;
+    }
+    MapIterator &operator--() noexcept {
+      this->template Step<false>();
+      return *this;
+    }
     MapIterator &operator+=(const size_type rhs) noexcept {
       *this = *this + rhs;
       return *this;
@@ -98,10 +117,10 @@ class map {
       return *this;
     }
   };
-  class MapConstIterator : public TreeConstIterator<Key, T> {
+  class MapConstIterator : public TreeConstIterator<Key, T, OrderStatistics> {
    public:
-    using TreeConstIterator<Key, T>::TreeConstIterator;
-    MapConstIterator(const TreeConstIterator<Key, T> &other)
+    using TreeConstIterator<Key, T, OrderStatistics>::TreeConstIterator;
+    MapConstIterator(const TreeConstIterator<Key, T, OrderStatistics> &other)
         : MapConstIterator(other.current_, other.end_) {}
     const value_type operator*() const noexcept {
       return std::pair<key_type, mapped_type>(this->current_->key_,
@@ -115,8 +134,14 @@ class map {
       MapConstIterator it(*this);
       return it.MoveIterator(rhs, false);
     }
-    MapConstIterator &operator++() noexcept { return *this += 1; }
-    MapConstIterator &operator--() noexcept { return *this -= 1; }
+    MapConstIterator &operator++() noexcept {
+      this->template Step<true>();
+      return *this;
+    }
+    MapConstIterator &operator--() noexcept {
+      this->template Step<false>();
+      return *this;
+    }
     MapConstIterator &operator+=(const size_type rhs) noexcept {
       *this = *this + rhs;
       return *this;
@@ -127,6 +152,13 @@ class map {
     }
   };
 
+  // what inserting a node reports; node keeps a rejected duplicate
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
+
   // map capacity
   bool empty() const noexcept { return rb.root_ == nullptr; }
   size_type size() const noexcept { return rb.size(); }
@@ -138,42 +170,117 @@ class map {
     return rb.insert(value.first, value.second, true);
   }
 
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return rb.insert(value.first, std::move(value.second), true);
+  }
   std::pair<iterator, bool> insert(const Key &key, const T &obj) {
     return rb.insert(key, obj, true);
   }
+  std::pair<iterator, bool> insert(Key &&key, T &&obj) {
+    return rb.insert(std::move(key), std::move(obj), true);
+  }
+  // builds the pair first, the key is needed before a node can be placed
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    std::pair<key_type, mapped_type> value(std::forward<Args>(args)...);
+    return rb.insert(std::move(value.first), std::move(value.second), true);
+  }
+  // hinted insertion, amortized O(1) when the element belongs right
+  // before hint
+  iterator insert(const_iterator hint, const value_type &value) {
+    return iterator(
+        rb.emplace_hint(hint.current_, true, value.first, value.second).first,
+        &rb.end_node_);
+  }
+  iterator insert(const_iterator hint, value_type &&value) {
+    return iterator(rb.emplace_hint(hint.current_, true, value.first,
+                                    std::move(value.second))
+                        .first,
+                    &rb.end_node_);
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    std::pair<key_type, mapped_type> value(std::forward<Args>(args)...);
+    return iterator(rb.emplace_hint(hint.current_, true, std::move(value.first),
+                                    std::move(value.second))
+                        .first,
+                    &rb.end_node_);
+  }
+  // leaves args untouched when the key is already present
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args) {
+    return rb.try_emplace(key, std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args) {
+    return rb.try_emplace(std::move(key), std::forward<Args>(args)...);
+  }
 
-  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
-    std::pair<iterator, bool> p = insert(key, obj);
-    if (!p.second) {
-      p.first = rb.find(key);
-      (*p.first).second = obj;
-    }
+  // one descent: obj is assigned to the node holding key, or a node is
+  // built from it at the leaf the same descent stopped at
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key &key, M &&obj) {
+    std::pair<iterator, bool> p = try_emplace(key, std::forward<M>(obj));
+    if (!p.second) p.first->value_ = std::forward<M>(obj);
     return p;
   }
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(Key &&key, M &&obj) {
+    std::pair<iterator, bool> p =
+        try_emplace(std::move(key), std::forward<M>(obj));
+    if (!p.second) p.first->value_ = std::forward<M>(obj);
+    return p;
+  }
+  // replaces the contents; input already in key order is linked in O(n)
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    rb.assign(first, last, true);
+  }
   void erase(iterator pos) noexcept { rb.erase(pos); }
   void erase(const key_type &key) noexcept { rb.erase(key); }
   void swap(map &other) noexcept { rb.swap(other.rb); }
-  void merge(map &other) {
-    for (auto it : other) {
-      insert(it);
-    }
+  // relinks the nodes of other whose keys are missing here; duplicates
+  // stay behind in other
+  void merge(map &other) { rb.merge(other.rb, true); }
+  node_type extract(const_iterator pos) noexcept { return rb.extract(pos); }
+  node_type extract(const Key &key) noexcept { return rb.extract(key); }
+  insert_return_type insert(node_type &&node) {
+    std::pair<typename tree_type::tree_node *, bool> p =
+        rb.insert_node(std::move(node), true);
+    return insert_return_type{iterator(p.first, &rb.end_node_), p.second,
+                              std::move(node)};
   }
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args &&...args) noexcept {
     vector<std::pair<iterator, bool>> res;
 
     res.reserve(sizeof...(args));
-    for (auto &&arg : {args...}) {
-      res.push_back(rb.insert(arg.first, arg.second, true));
-    }
+    (res.push_back(emplace(std::forward<Args>(args))), ...);
     return res;
   }
 
   // map lookup
+  iterator find(const Key &key) noexcept { return rb.find(key); }
+  // heterogeneous lookup, available when Compare is transparent
+  template <typename K, typename C = Compare, typename = if_transparent<C>>
+  iterator find(const K &key) noexcept {
+    return rb.find(key);
+  }
   bool contains(const Key &key) const noexcept { return rb.contains(key); }
+  template <typename K, typename C = Compare, typename = if_transparent<C>>
+  bool contains(const K &key) const noexcept {
+    return rb.contains(key);
+  }
+
+  // map order statistics, O(log n); need OrderStatistics set
+  iterator nth(size_type index) noexcept { return rb.nth(index); }
+  size_type rank(const Key &key) const noexcept { return rb.rank(key); }
+
+  // map observers
+  key_compare key_comp() const { return rb.key_comp(); }
 
  private:
-  RBTree<key_type, mapped_type> rb;
+  tree_type rb;
 };
 };  // namespace s21
 
@@ -0,0 +1,288 @@
+#ifndef S21_CONTAINERS_S21_MEMORY_MEMORY_H_
+#define S21_CONTAINERS_S21_MEMORY_MEMORY_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// A type is trivially relocatable when moving an object to a new address
+// and forgetting the old one is the same as a memcpy. That holds for every
+// trivially copyable type and for owning types that keep no pointer into
+// the object itself, such as unique_ptr. It does not hold for everything
+// that owns memory: libstdc++'s std::string points into its own short
+// string buffer. Only specialise it to true for your own types when they
+// have no such self-pointers, to let the s21 sequence containers relocate
+// them with memcpy/memmove; the fast path bypasses allocator
+// construct()/destroy() for such types.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// Uninitialized-storage helpers shared by the contiguous containers. All of
+// them go through allocator_traits so a custom allocator still sees every
+// construction, except where the type allows plain memory copies.
+namespace memory {
+template <typename Alloc, typename T>
+void destroy(Alloc &alloc, T *first, T *last) noexcept {
+  if constexpr (!std::is_trivially_destructible<T>::value) {
+    for (; first != last; ++first) {
+      std::allocator_traits<Alloc>::destroy(alloc, first);
+    }
+  }
+}
+
+// Copy-constructs count elements into raw storage, returns the new end.
+template <typename Alloc, typename T>
+T *uninitialized_copy(Alloc &alloc, const T *src, std::size_t count,
+                      T *dest) {
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    if (count != 0) std::memcpy(dest, src, count * sizeof(T));
+    return dest + count;
+  } else {
+    T *cur = dest;
+    try {
+      for (std::size_t i = 0; i < count; ++i, ++cur) {
+        std::allocator_traits<Alloc>::construct(alloc, cur, src[i]);
+      }
+    } catch (...) {
+      destroy(alloc, dest, cur);
+      throw;
+    }
+    return cur;
+  }
+}
+
+// Move-constructs count elements into raw storage, copying instead when the
+// move constructor may throw so that a failure leaves src intact.
+template <typename Alloc, typename T>
+T *uninitialized_move(Alloc &alloc, T *src, std::size_t count, T *dest) {
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    if (count != 0) std::memcpy(dest, src, count * sizeof(T));
+    return dest + count;
+  } else {
+    T *cur = dest;
+    try {
+      for (std::size_t i = 0; i < count; ++i, ++cur) {
+        std::allocator_traits<Alloc>::construct(
+            alloc, cur, std::move_if_noexcept(src[i]));
+      }
+    } catch (...) {
+      destroy(alloc, dest, cur);
+      throw;
+    }
+    return cur;
+  }
+}
+
+// Moves count elements to non-overlapping raw storage and ends the lifetime
+// of the sources.
+template <typename Alloc, typename T>
+void relocate(Alloc &alloc, T *src, std::size_t count, T *dest) {
+  if constexpr (is_trivially_relocatable<T>::value) {
+    if (count != 0) {
+      std::memcpy(static_cast<void *>(dest), static_cast<void *>(src),
+                  count * sizeof(T));
+    }
+  } else {
+    uninitialized_move(alloc, src, count, dest);
+    destroy(alloc, src, src + count);
+  }
+}
+
+// Relocates [first, first + first_count) to first_dest and [second,
+// second + second_count) to second_dest, all in non-overlapping raw
+// storage. When a move throws, both runs stay where they were and nothing
+// built at the destinations survives.
+template <typename Alloc, typename T>
+void relocate_runs(Alloc &alloc, T *first, std::size_t first_count,
+                   T *first_dest, T *second, std::size_t second_count,
+                   T *second_dest) {
+  if constexpr (is_trivially_relocatable<T>::value) {
+    relocate(alloc, first, first_count, first_dest);
+    relocate(alloc, second, second_count, second_dest);
+  } else {
+    uninitialized_move(alloc, first, first_count, first_dest);
+    try {
+      uninitialized_move(alloc, second, second_count, second_dest);
+    } catch (...) {
+      destroy(alloc, first_dest, first_dest + first_count);
+      throw;
+    }
+    destroy(alloc, first, first + first_count);
+    destroy(alloc, second, second + second_count);
+  }
+}
+
+// The growth step of the contiguous containers: builds a value from args
+// at new_v + offset, then relocates the size elements of old around it.
+// The value comes first, so args may still refer into old. When anything
+// throws, old is left as it was and new_v holds nothing; freeing new_v is
+// up to the caller.
+template <typename Alloc, typename T, typename... Args>
+void construct_and_relocate(Alloc &alloc, T *old, std::size_t size,
+                            std::size_t offset, T *new_v, Args &&...args) {
+  T *slot = new_v + offset;
+  std::allocator_traits<Alloc>::construct(alloc, slot,
+                                          std::forward<Args>(args)...);
+  try {
+    relocate_runs(alloc, old, offset, new_v, old + offset, size - offset,
+                  slot + 1);
+  } catch (...) {
+    std::allocator_traits<Alloc>::destroy(alloc, slot);
+    throw;
+  }
+}
+
+// Elements built ahead of an insertion in raw storage owned by the caller's
+// frame. Building them first keeps the arguments safe to evaluate even when
+// they refer to elements that the insertion (or a reallocation before it)
+// is about to move.
+template <typename Alloc, typename T, std::size_t Count>
+class pending_values {
+ public:
+  template <typename... Args>
+  explicit pending_values(Alloc &alloc, Args &&...args) : alloc_(alloc) {
+    static_assert(sizeof...(Args) == Count, "one argument per value");
+    T *built = values();
+    try {
+      ((std::allocator_traits<Alloc>::construct(alloc_, built,
+                                                std::forward<Args>(args)),
+        ++built),
+       ...);
+    } catch (...) {
+      destroy(alloc_, values(), built);
+      throw;
+    }
+  }
+  // builds the only value of a single-element insertion from constructor
+  // arguments
+  template <typename... Args>
+  pending_values(std::in_place_t, Alloc &alloc, Args &&...args)
+      : alloc_(alloc) {
+    static_assert(Count == 1, "in-place construction builds one value");
+    std::allocator_traits<Alloc>::construct(alloc_, values(),
+                                            std::forward<Args>(args)...);
+  }
+  pending_values(const pending_values &) = delete;
+  pending_values &operator=(const pending_values &) = delete;
+  ~pending_values() noexcept {
+    if (!relocated_) destroy(alloc_, values(), values() + Count);
+  }
+
+  // the built values, for containers that place them one at a time; they
+  // are still destroyed with this object once moved from
+  T &operator[](std::size_t i) noexcept { return values()[i]; }
+
+  // Opens a gap of Count slots at pos in [pos, finish), which must have that
+  // much free space past finish, moves the values in and advances finish.
+  void insert_at(T *pos, T *&finish) {
+    if constexpr (is_trivially_relocatable<T>::value) {
+      std::memmove(static_cast<void *>(pos + Count), static_cast<void *>(pos),
+                   (finish - pos) * sizeof(T));
+      std::memcpy(static_cast<void *>(pos), storage_, Count * sizeof(T));
+      finish += Count;
+      relocated_ = true;
+    } else {
+      // one pass: the last elements move to the raw slots past finish, the
+      // rest of the tail shifts by Count, and the values fill the gap; on
+      // failure everything built past finish is destroyed again
+      using alloc_traits = std::allocator_traits<Alloc>;
+      std::size_t moved = std::min<std::size_t>(Count, finish - pos);
+      T *shifted = finish + Count - moved;
+      T *built = shifted;
+      T *gap = finish;
+      try {
+        for (T *src = finish - moved; src != finish; ++src, ++built) {
+          alloc_traits::construct(alloc_, built, std::move(*src));
+        }
+        std::move_backward(pos, finish - moved, shifted);
+        for (std::size_t i = 0; i < Count; ++i) {
+          if (pos + i < finish) {
+            pos[i] = std::move(values()[i]);
+          } else {
+            alloc_traits::construct(alloc_, gap, std::move(values()[i]));
+            ++gap;
+          }
+        }
+      } catch (...) {
+        destroy(alloc_, finish, gap);
+        destroy(alloc_, shifted, built);
+        throw;
+      }
+      finish += Count;
+    }
+  }
+
+ private:
+  T *values() noexcept { return reinterpret_cast<T *>(storage_); }
+
+  Alloc &alloc_;
+  alignas(T) unsigned char storage_[(Count == 0 ? 1 : Count) * sizeof(T)];
+  bool relocated_ = false;
+};
+
+// Builds a value from args at pos in [pos, finish), which must have a free
+// slot past finish, shifting the tail right and advancing finish.
+template <typename Alloc, typename T, typename... Args>
+void emplace_shift(Alloc &alloc, T *pos, T *&finish, Args &&...args) {
+  if (pos == finish) {
+    std::allocator_traits<Alloc>::construct(alloc, finish,
+                                            std::forward<Args>(args)...);
+    ++finish;
+  } else {
+    pending_values<Alloc, T, 1>(std::in_place, alloc,
+                                std::forward<Args>(args)...)
+        .insert_at(pos, finish);
+  }
+}
+
+// Removes the element at pos from [pos, finish), shifting the tail left;
+// the slot at finish - 1 is raw afterwards.
+template <typename Alloc, typename T>
+void erase_shift(Alloc &alloc, T *pos, T *finish) noexcept {
+  if constexpr (is_trivially_relocatable<T>::value) {
+    std::allocator_traits<Alloc>::destroy(alloc, pos);
+    std::memmove(static_cast<void *>(pos), static_cast<void *>(pos + 1),
+                 (finish - pos - 1) * sizeof(T));
+  } else {
+    std::move(pos + 1, finish, pos);
+    std::allocator_traits<Alloc>::destroy(alloc, finish - 1);
+  }
+}
+
+// Room for N elements inside the owning object, of which the first count
+// are alive. For trivial types it is a plain value-initialised array, so
+// the owner stays a literal type usable in constant expressions; other
+// types get raw bytes and the live elements die with the storage.
+template <typename T, std::size_t N, bool = std::is_trivial<T>::value>
+struct static_storage {
+  constexpr T *data() noexcept { return slots; }
+  constexpr const T *data() const noexcept { return slots; }
+
+  T slots[N == 0 ? 1 : N] = {};
+  std::size_t count = 0;
+};
+template <typename T, std::size_t N>
+struct static_storage<T, N, false> {
+  static_storage() noexcept = default;
+  static_storage(const static_storage &) = delete;
+  static_storage &operator=(const static_storage &) = delete;
+  ~static_storage() noexcept {
+    std::allocator<T> alloc;
+    destroy(alloc, data(), data() + count);
+  }
+  T *data() noexcept { return reinterpret_cast<T *>(bytes); }
+  const T *data() const noexcept {
+    return reinterpret_cast<const T *>(bytes);
+  }
+
+  alignas(T) unsigned char bytes[(N == 0 ? 1 : N) * sizeof(T)];
+  std::size_t count = 0;
+};
+}  // namespace memory
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_MEMORY_MEMORY_H_
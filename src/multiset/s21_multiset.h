@@ -1,6 +1,7 @@
 #ifndef S21_CONTAINERS_S21_MULTISET_MULTISET_H_
 #define S21_CONTAINERS_S21_MULTISET_MULTISET_H_
 
+#include <functional>
 #include <initializer_list>
 #include <limits>
 #include <new>
@@ -13,8 +14,16 @@
 namespace s21 {
 using namespace rbtree;
 
-template <typename Key>
+template <typename Key, typename Compare = std::less<Key>,
+          bool OrderStatistics = false>
 class multiset {
+  using tree_type = RBTree<Key, KeyOnly, Compare, OrderStatistics>;
+  using tree_iterator = typename tree_type::tree_iterator;
+  using tree_const_iterator = TreeConstIterator<Key, KeyOnly, OrderStatistics>;
+
+  template <typename C>
+  using if_transparent = typename C::is_transparent;
+
  public:
   class multisetIterator;
   class multisetConstIterator;
@@ -25,13 +34,23 @@ class multiset {
   using iterator = multisetIterator;
   using const_iterator = multisetConstIterator;
   using size_type = size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using node_type = typename tree_type::node_handle;
+  using node_pool = typename tree_type::pool_type;
 
   // set member functions
   multiset() : rb() {}
+  explicit multiset(const Compare &comp) : rb(comp) {}
+  explicit multiset(std::shared_ptr<node_pool> pool) noexcept
+      : rb(std::move(pool)) {}
   multiset(std::initializer_list<value_type> const &items) {
-    for (const_reference value_ : items) {
-      rb.insert(value_, value_, false);
-    }
+    assign_sorted(items.begin(), items.end());
+  }
+  template <typename InputIt,
+            typename = decltype(*std::declval<InputIt &>())>
+  multiset(InputIt first, InputIt last) {
+    assign_sorted(first, last);
   }
   multiset(const multiset &s) { *this = s; }
   multiset(multiset &&s) { *this = std::move(s); }
@@ -63,19 +82,52 @@ class multiset {
   // Modifiers
   void clear() { rb.clear(); }
   std::pair<iterator, bool> insert(const value_type &value) {
-    std::pair<Node<value_type, key_type> *, bool> p;
-    p = rb.insert(value, value, false);
+    std::pair<typename tree_type::tree_node *, bool> p;
+    p = rb.insert(value, false);
+    multisetIterator it(p.first, &rb.end_node_);
+    return std::pair<multisetIterator, bool>(it, p.second);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    std::pair<typename tree_type::tree_node *, bool> p;
+    p = rb.insert(std::move(value), false);
     multisetIterator it(p.first, &rb.end_node_);
     return std::pair<multisetIterator, bool>(it, p.second);
   }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
 
+  // hinted insertion, amortized O(1) when the element belongs right
+  // before hint
+  iterator insert(const_iterator hint, const value_type &value) {
+    return iterator(rb.emplace_hint(hint.current_, false, value).first,
+                    &rb.end_node_);
+  }
+  iterator insert(const_iterator hint, value_type &&value) {
+    return iterator(
+        rb.emplace_hint(hint.current_, false, std::move(value)).first,
+        &rb.end_node_);
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return insert(hint, value_type(std::forward<Args>(args)...));
+  }
+  // replaces the contents; input already in key order is linked in O(n)
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    rb.assign(first, last, false);
+  }
   void erase(iterator pos) { rb.erase(pos); }
   void erase(const key_type &key) { rb.erase(key); }
   void swap(multiset &other) { rb.swap(other.rb); }
-  void merge(multiset &other) {
-    for (auto it : other) {
-      insert(it);
-    }
+  // relinks every node of other, leaving it empty
+  void merge(multiset &other) { rb.merge(other.rb, false); }
+  node_type extract(const_iterator pos) noexcept { return rb.extract(pos); }
+  node_type extract(const Key &key) noexcept { return rb.extract(key); }
+  iterator insert(node_type &&node) {
+    return iterator(rb.insert_node(std::move(node), false).first,
+                    &rb.end_node_);
   }
 
   template <typename... Args>
@@ -83,9 +135,7 @@ class multiset {
     vector<std::pair<iterator, bool>> res;
 
     res.reserve(sizeof...(args));
-    for (auto &&arg : {args...}) {
-      res.push_back(rb.insert(arg, arg, false));
-    }
+    (res.push_back(insert(std::forward<Args>(args))), ...);
     return res;
   }
 
@@ -94,31 +144,61 @@ class multiset {
   bool contains(const Key &key) { return rb.contains(key); }
   size_type count(const Key &key) { return rb.count(key); }
   std::pair<iterator, iterator> equal_range(const Key &key) {
-    iterator start(find(key)), finish(start);
-    if (finish != end()) {
-      for (; finish + 1 != end() && *(finish) == key; ++finish)
-        ;
-    }
-    return std::pair<iterator, iterator>(start, finish);
+    auto range = rb.equal_range(key);
+    return std::pair<iterator, iterator>(range.first, range.second);
   }
   iterator lower_bound(const Key &key) { return rb.lower_bound(key); }
   iterator upper_bound(const Key &key) { return rb.upper_bound(key); }
+  // heterogeneous lookup, available when Compare is transparent
+  template <typename K, typename C = Compare, typename = if_transparent<C>>
+  iterator find(const K &key) {
+    return rb.find(key);
+  }
+  template <typename K, typename C = Compare, typename = if_transparent<C>>
+  bool contains(const K &key) {
+    return rb.contains(key);
+  }
+  template <typename K, typename C = Compare, typename = if_transparent<C>>
+  size_type count(const K &key) {
+    return rb.count(key);
+  }
+  template <typename K, typename C = Compare, typename = if_transparent<C>>
+  std::pair<iterator, iterator> equal_range(const K &key) {
+    auto range = rb.equal_range(key);
+    return std::pair<iterator, iterator>(range.first, range.second);
+  }
+  template <typename K, typename C = Compare, typename = if_transparent<C>>
+  iterator lower_bound(const K &key) {
+    return rb.lower_bound(key);
+  }
+  template <typename K, typename C = Compare, typename = if_transparent<C>>
+  iterator upper_bound(const K &key) {
+    return rb.upper_bound(key);
+  }
+
+  // Order statistics, O(log n); need OrderStatistics set
+  iterator nth(size_type index) noexcept { return rb.nth(index); }
+  size_type rank(const Key &key) const noexcept { return rb.rank(key); }
+
+  // Observers
+  key_compare key_comp() const { return rb.key_comp(); }
+  value_compare value_comp() const { return rb.key_comp(); }
 
-  class multisetIterator : public TreeIterator<value_type> {
+  class multisetIterator : public tree_iterator {
    public:
-    using TreeIterator<value_type>::TreeIterator;
-    multisetIterator(const TreeIterator<value_type, key_type> &other)
+    using tree_iterator::tree_iterator;
+    multisetIterator(const tree_iterator &other)
         : multisetIterator(other.current_, other.end_) {}
   };
-  class multisetConstIterator : public TreeConstIterator<value_type> {
+  class multisetConstIterator : public tree_const_iterator {
    public:
-    using TreeConstIterator<value_type>::TreeConstIterator;
-    multisetConstIterator(const TreeIterator<value_type, key_type> &other)
+    using tree_const_iterator::tree_const_iterator;
+    multisetConstIterator(const tree_iterator &other)
         : multisetConstIterator(other.current_, other.end_) {}
   };
 
  private:
-  RBTree<value_type, key_type> rb;
+  tree_type rb;
 };
 };  // namespace s21
 
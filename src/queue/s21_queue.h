@@ -1,10 +1,13 @@
 #ifndef S21_CONTAINERS_S21_QUEUE_H_
 #define S21_CONTAINERS_S21_QUEUE_H_
 
+#include "../deque/s21_deque.h"
 #include "../list/s21_list.h"
 
 namespace s21 {
-template <typename T, class Container = list<T>>
+// Container defaults to the ring-buffer deque; s21::list, or anything else
+// with the same members, can be passed instead.
+template <typename T, class Container = deque<T>>
 class queue {
   using value_type = T;
   using reference = T &;
@@ -12,33 +15,38 @@ class queue {
   using size_type = size_t;
 
  public:
-  queue() noexcept : list_() {}
-  queue(std::initializer_list<value_type> const &items) : list_(items) {}
-  queue(const queue &q) : list_(q.list_) {}
-  queue(queue &&q) noexcept : list_(std::move(q.list_)) {}
+  queue() noexcept : c_() {}
+  queue(std::initializer_list<value_type> const &items) : c_(items) {}
+  queue(const queue &q) : c_(q.c_) {}
+  queue(queue &&q) noexcept : c_(std::move(q.c_)) {}
   ~queue() noexcept {};
   queue &operator=(const queue &q) {
-    list_ = q.list_;
+    c_ = q.c_;
     return *this;
   }
   queue operator=(queue &&q) noexcept {
-    list_ = std::move(q.list_);
+    c_ = std::move(q.c_);
     return *this;
   }
-  const_reference front() const noexcept { return list_.front(); }
-  const_reference back() const noexcept { return list_.back(); }
-  bool empty() const noexcept { return list_.empty(); }
-  size_type size() const noexcept { return list_.size(); }
-  void push(const_reference value) { list_.push_back(value); }
-  void pop() noexcept { list_.pop_front(); }
-  void swap(queue &other) noexcept { list_.swap(other.list_); };
+  const_reference front() const noexcept { return c_.front(); }
+  const_reference back() const noexcept { return c_.back(); }
+  bool empty() const noexcept { return c_.empty(); }
+  size_type size() const noexcept { return c_.size(); }
+  void push(const_reference value) { c_.push_back(value); }
+  void push(value_type &&value) { c_.push_back(std::move(value)); }
+  template <class... Args>
+  void emplace(Args &&...args) {
+    c_.emplace_back(std::forward<Args>(args)...);
+  }
+  void pop() noexcept { c_.pop_front(); }
+  void swap(queue &other) noexcept { c_.swap(other.c_); };
   template <class... Args>
   void insert_many_back(Args &&...args) {
-    list_.insert_many_back(std::forward<Args>(args)...);
+    c_.insert_many_back(std::forward<Args>(args)...);
   }
 
  private:
-  Container list_;
+  Container c_;
 };
 }  // namespace s21
 
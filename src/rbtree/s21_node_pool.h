@@ -0,0 +1,107 @@
+#ifndef S21_CONTAINERS_S21_RBTREE_NODE_POOL_H_
+#define S21_CONTAINERS_S21_RBTREE_NODE_POOL_H_
+
+#include <cstddef>
+
+namespace rbtree {
+// Slab allocator for tree nodes. Memory is taken from the global allocator
+// in slabs of growing size and handed out slot by slot; freed slots go to
+// a LIFO free list so the most recently released (cache-warm) slot is
+// reused first. release() drops every slab at once. The pool does not
+// construct or destroy nodes and is not thread-safe: trees sharing one pool
+// must be used from a single thread.
+template <typename node_type>
+class NodePool {
+ public:
+  using size_type = std::size_t;
+
+  NodePool() noexcept = default;
+  NodePool(const NodePool &) = delete;
+  NodePool &operator=(const NodePool &) = delete;
+  ~NodePool() noexcept { release(); }
+
+  void *allocate() {
+    Slot *slot = free_list_;
+    if (slot != nullptr) {
+      free_list_ = slot->next;
+    } else {
+      if (bump_ == bump_end_) {
+        AddSlab(slab_size_);
+        if (slab_size_ < kMaxSlabSize) slab_size_ *= 2;
+      }
+      slot = bump_++;
+    }
+    return slot;
+  }
+
+  void deallocate(void *ptr) noexcept {
+    Slot *slot = static_cast<Slot *>(ptr);
+    slot->next = free_list_;
+    free_list_ = slot;
+  }
+
+  // makes room for count more nodes in a single slab, so that a bulk build
+  // allocates once; what is left of the current slab stays unused
+  void reserve(size_type count) {
+    if (static_cast<size_type>(bump_end_ - bump_) < count) AddSlab(count + 1);
+  }
+
+  // Takes over every slab of other, including slots still holding live
+  // nodes, which from now on are returned to this pool. other is left
+  // empty. Nothing is allocated or copied.
+  void absorb(NodePool &other) noexcept {
+    if (&other == this) return;
+    while (other.bump_ != other.bump_end_) deallocate(other.bump_++);
+    while (other.free_list_ != nullptr) {
+      Slot *slot = other.free_list_;
+      other.free_list_ = slot->next;
+      deallocate(slot);
+    }
+    while (other.slabs_ != nullptr) {
+      Slot *slab = other.slabs_;
+      other.slabs_ = slab->next;
+      slab->next = slabs_;
+      slabs_ = slab;
+    }
+    other.release();
+  }
+
+  void release() noexcept {
+    while (slabs_ != nullptr) {
+      Slot *next = slabs_->next;
+      delete[] slabs_;
+      slabs_ = next;
+    }
+    free_list_ = nullptr;
+    bump_ = nullptr;
+    bump_end_ = nullptr;
+    slab_size_ = kFirstSlabSize;
+  }
+
+ private:
+  static constexpr size_type kFirstSlabSize = 16;
+  static constexpr size_type kMaxSlabSize = 4096;
+
+  union Slot {
+    Slot *next;
+    alignas(node_type) unsigned char storage[sizeof(node_type)];
+  };
+
+  // slot 0 of every slab links to the previously allocated slab
+  void AddSlab(size_type size) {
+    Slot *slab = new Slot[size];
+    slab->next = slabs_;
+    slabs_ = slab;
+    bump_ = slab + 1;
+    bump_end_ = slab + size;
+  }
+
+  Slot *free_list_ = nullptr;
+  Slot *slabs_ = nullptr;
+  Slot *bump_ = nullptr;
+  Slot *bump_end_ = nullptr;
+  size_type slab_size_ = kFirstSlabSize;
+};
+};  // namespace rbtree
+
+#endif  // S21_CONTAINERS_S21_RBTREE_NODE_POOL_H_
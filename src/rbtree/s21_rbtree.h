@@ -2,54 +2,230 @@
 #define S21_CONTAINERS_S21_RBTREE_RBTREE_H_
 
 #include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
+#include "s21_node_pool.h"
+
 namespace rbtree {
-template <typename key_type, typename value_type>
-class Node {
+// Subtree size kept by order-statistic trees; an empty base otherwise.
+template <bool order_statistics>
+class SubtreeSize {};
+
+template <>
+class SubtreeSize<true> {
  public:
-  Node(){};
-  Node(key_type key, value_type value, char color)
-      : key_(key), value_(value), color_(color){};
-  Node(key_type key, value_type value)
-      : key_(key), value_(value), color_('R'){};
+  std::size_t subtree_size_ = 1;
+};
 
-  Node<key_type, value_type> *GetChildren(
-      char direction, bool is_reverse = false) const noexcept {
-    bool is_left = direction == 'L';
-    if (is_reverse ^ is_left) {
-      return left_;
+template <typename NodeType>
+std::size_t SubtreeSizeOf(const NodeType *node) noexcept {
+  return node == nullptr ? 0 : node->subtree_size_;
+}
+
+// the node at in-order position index of the subtree under node, which
+// must hold more than index nodes
+template <typename NodeType>
+NodeType *SelectNode(NodeType *node, std::size_t index) noexcept {
+  for (;;) {
+    std::size_t left_size = SubtreeSizeOf(node->left_);
+    if (index == left_size) return node;
+    if (index < left_size) {
+      node = node->left_;
     } else {
+      index -= left_size + 1;
+      node = node->right_;
+    }
+  }
+}
+
+// Colour and links shared by every node layout; NodeType is the node class
+// deriving from it, so that the links point at whole nodes. The colour
+// lives in the low bit of the parent pointer, which node alignment always
+// leaves clear, so a node spends no padded byte on it. The child links
+// come first: together with the key that follows them in the derived node
+// they are all a lookup descent touches.
+
+template <typename NodeType, bool order_statistics>
+class NodeLinks : public SubtreeSize<order_statistics> {
+ public:
+  NodeLinks() = default;
+  explicit NodeLinks(char color) noexcept
+      : parent_and_color_(color == 'R' ? kRedBit : 0) {}
+
+  // child on the right side when right is set; resolved at compile time
+  template <bool right>
+  NodeType *child() const noexcept {
+    if constexpr (right) {
       return right_;
+    } else {
+      return left_;
     }
   }
 
+  NodeType *parent() const noexcept {
+    return reinterpret_cast<NodeType *>(parent_and_color_ & ~kRedBit);
+  }
+  void set_parent(NodeType *parent) noexcept {
+    parent_and_color_ = reinterpret_cast<std::uintptr_t>(parent) |
+                        (parent_and_color_ & kRedBit);
+  }
+  char color() const noexcept {
+    return (parent_and_color_ & kRedBit) != 0 ? 'R' : 'B';
+  }
+  void set_color(char color) noexcept {
+    parent_and_color_ = (parent_and_color_ & ~kRedBit) |
+                        (color == 'R' ? kRedBit : std::uintptr_t(0));
+  }
+
+  NodeType *left_ = nullptr;
+  NodeType *right_ = nullptr;
+
+  NodeType *getBrother() const noexcept {
+    if (this == parent()->left_) return parent()->right_;
+    return parent()->left_;
+  }
+
+ private:
+  static constexpr std::uintptr_t kRedBit = 1;
+
+  std::uintptr_t parent_and_color_ = 0;
+};
+
+// Value type of set-style trees: their nodes hold the key alone, and
+// iterators dereference to that key.
+struct KeyOnly {};
+
+template <typename key_type, typename value_type,
+          bool order_statistics = false>
+class Node : public NodeLinks<Node<key_type, value_type, order_statistics>,
+                              order_statistics> {
+ public:
+  Node(){};
+  Node(key_type key, value_type value, char color)
+      : NodeLinks<Node, order_statistics>(color), key_(key), value_(value){};
+  Node(key_type key, value_type value)
+      : NodeLinks<Node, order_statistics>('R'), key_(key), value_(value){};
+  // key_ from key, value_ built in place from args
+  template <typename K, typename... Args>
+  Node(std::piecewise_construct_t, K &&key, Args &&...args)
+      : NodeLinks<Node, order_statistics>('R'),
+        key_(std::forward<K>(key)),
+        value_(std::forward<Args>(args)...){};
+
+  value_type &value() noexcept { return value_; }
+  const value_type &value() const noexcept { return value_; }
+
   key_type key_ = key_type();
   value_type value_ = value_type();
-  char color_ = 'B';
-  Node<key_type, value_type> *left_ = nullptr;
-  Node<key_type, value_type> *right_ = nullptr;
-  Node<key_type, value_type> *parent_ = nullptr;
+};
+
+template <typename key_type, bool order_statistics>
+class Node<key_type, KeyOnly, order_statistics>
+    : public NodeLinks<Node<key_type, KeyOnly, order_statistics>,
+                       order_statistics> {
+ public:
+  Node(){};
+  template <typename K>
+  Node(std::piecewise_construct_t, K &&key)
+      : NodeLinks<Node, order_statistics>('R'), key_(std::forward<K>(key)){};
+
+  // read-only, rewriting the key in place would break the ordering
+  const key_type &value() const noexcept { return key_; }
+
+  key_type key_ = key_type();
+};
+
+// node size budget: three pointer-sized links plus the payload, with no
+// byte spent on the colour
+static_assert(sizeof(NodeLinks<Node<int, int>, false>) == 3 * sizeof(void *),
+              "node links must stay three pointers wide");
+static_assert(sizeof(Node<int, int>) == 3 * sizeof(void *) + 2 * sizeof(int),
+              "an int map node must be its links and payload only");
+static_assert(sizeof(Node<void *, KeyOnly>) == 4 * sizeof(void *),
+              "a pointer set node must be its links and key only");
+static_assert(sizeof(Node<void *, KeyOnly, true>) == 5 * sizeof(void *),
+              "order statistics must cost one size_t per node");
+
+// Owns a node extracted from a tree, together with a share of the pool the
+// node lives in, until the node is inserted into a tree again or the
+// handle goes away. The key may be changed in between.
+template <typename key_type, typename value_type,
+          bool order_statistics = false>
+class NodeHandle {
+ public:
+  using tree_node = Node<key_type, value_type, order_statistics>;
+  using pool_type = NodePool<tree_node>;
+
+  NodeHandle() noexcept = default;
+  NodeHandle(NodeHandle &&other) noexcept
+      : node_(other.node_), pool_(std::move(other.pool_)) {
+    other.node_ = nullptr;
+  }
+  NodeHandle &operator=(NodeHandle &&other) noexcept {
+    if (this != &other) {
+      reset();
+      node_ = other.node_;
+      pool_ = std::move(other.pool_);
+      other.node_ = nullptr;
+    }
+    return *this;
+  }
+  ~NodeHandle() noexcept { reset(); }
+
+  bool empty() const noexcept { return node_ == nullptr; }
+  explicit operator bool() const noexcept { return node_ != nullptr; }
+  // map handles
+  key_type &key() const noexcept { return node_->key_; }
+  value_type &mapped() const noexcept { return node_->value_; }
+  // set handles
+  key_type &value() const noexcept { return node_->key_; }
+
+  void swap(NodeHandle &other) noexcept {
+    std::swap(node_, other.node_);
+    pool_.swap(other.pool_);
+  }
+
+ private:
+  template <typename, typename, typename, bool>
+  friend class RBTree;
+
+  NodeHandle(tree_node *node, std::shared_ptr<pool_type> pool) noexcept
+      : node_(node), pool_(std::move(pool)) {}
 
-  Node<key_type, value_type> *getBrother() const noexcept {
-    if (this == this->parent_->left_) return this->parent_->right_;
-    return this->parent_->left_;
+  void reset() noexcept {
+    if (node_ != nullptr) {
+      node_->~Node();
+      pool_->deallocate(node_);
+      node_ = nullptr;
+    }
+    pool_.reset();
   }
+
+  tree_node *node_ = nullptr;
+  std::shared_ptr<pool_type> pool_;
 };
 
-template <typename key_type, typename value_type = key_type>
+template <typename key_type, typename value_type = KeyOnly,
+          bool order_statistics = false>
 class TreeIterator {
  public:
   using size_type = std::size_t;
+  using tree_node = Node<key_type, value_type, order_statistics>;
 
   TreeIterator() noexcept : current_(nullptr), end_(nullptr) {}
-  TreeIterator(Node<key_type, value_type> *current) noexcept
+  TreeIterator(tree_node *current) noexcept
       : current_(current), end_(nullptr) {}
-  TreeIterator(Node<key_type, value_type> *current,
-               Node<key_type, value_type> *end) noexcept
+  TreeIterator(tree_node *current, tree_node *end) noexcept
       : current_(current), end_(end) {}
-  void SetNode(Node<key_type, value_type> *node) noexcept { current_ = node; }
-  void SetEnd(Node<key_type, value_type> *node) noexcept { end_ = node; }
+  void SetNode(tree_node *node) noexcept { current_ = node; }
+  void SetEnd(tree_node *node) noexcept { end_ = node; }
   TreeIterator operator+(const size_type rhs) const noexcept {
     TreeIterator it(*this);
     return it.MoveIterator(rhs, true);
@@ -58,8 +234,8 @@ class TreeIterator {
     TreeIterator it(*this);
     return it.MoveIterator(rhs, false);
   }
-  value_type &operator*() const noexcept { return current_->value_; }
-  Node<key_type, value_type> *operator->() const noexcept { return current_; }
+  decltype(auto) operator*() const noexcept { return current_->value(); }
+  tree_node *operator->() const noexcept { return current_; }
   operator void *() const noexcept { return current_; }
   bool operator>(const TreeIterator &other) const noexcept {
     return current_ > other.current_;
@@ -75,8 +251,14 @@ class TreeIterator {
     *this = *this - rhs;
     return *this;
   }
-  TreeIterator &operator++() noexcept { return *this += 1; }
-  TreeIterator &operator--() noexcept { return *this -= 1; }
+  TreeIterator &operator++() noexcept {
+    Step<true>();
+    return *this;
+  }
+  TreeIterator &operator--() noexcept {
+    Step<false>();
+    return *this;
+  }
   bool operator==(const TreeIterator &other) const noexcept {
     return other.current_ == current_;
   }
@@ -84,84 +266,190 @@ class TreeIterator {
     return other.current_ != current_;
   }
 
-  Node<key_type, value_type> *current_;
-  Node<key_type, value_type> *end_;
+  // in-order position, the element count for end(); O(log n)
+  size_type index() const noexcept {
+    static_assert(order_statistics, "index() needs an order-statistic tree");
+    if (current_ == end_) {
+      tree_node *max = end_->parent();
+      return max == nullptr ? 0 : SubtreeSizeOf(FindRoot(max));
+    }
+    size_type index = SubtreeSizeOf(current_->left_);
+    for (const tree_node *node = current_; node->parent() != nullptr;
+         node = node->parent()) {
+      if (node->parent()->right_ == node) {
+        index += SubtreeSizeOf(node->parent()->left_) + 1;
+      }
+    }
+    return index;
+  }
+
+  tree_node *current_;
+  tree_node *end_;
 
  protected:
-  TreeIterator(std::pair<Node<key_type, value_type> *, bool> res) noexcept
+  TreeIterator(std::pair<tree_node *, bool> res) noexcept
       : current_(res.first->current_) {}
 
-  std::pair<Node<key_type, value_type> *, bool> GetNext(
-      bool reverse = false) const noexcept {
-    Node<key_type, value_type> *next = nullptr;
-    bool found = false;
+  // Moves to the in-order neighbour, the next one when forward is set.
+  // Stepping off either edge gives end_, and stepping from end_ gives the
+  // last node. The direction is a template argument, so every child
+  // lookup on the way is a plain load.
+  template <bool forward>
+  void Step() noexcept {
     if (current_ == end_) {
-      return std::pair<Node<key_type, value_type> *, bool>(current_->parent_,
-                                                           true);
-    } else if (current_->GetChildren('R', reverse)) {
-      next = current_->GetChildren('R', reverse);
-      while (next->GetChildren('L', reverse)) {
-        next = next->GetChildren('L', reverse);
-      }
-      found = true;
-    } else {
-      next = current_->parent_;
-      Node<key_type, value_type> *prev = current_;
-      while (next && next->GetChildren('L', reverse) != prev) {
-        prev = next;
-        next = next->parent_;
+      current_ = end_->parent();
+      return;
+    }
+    tree_node *next = current_->template child<forward>();
+    if (next != nullptr) {
+      while (next->template child<!forward>() != nullptr) {
+        next = next->template child<!forward>();
       }
-      if (next != nullptr) found = true;
+      current_ = next;
+      return;
+    }
+    tree_node *node = current_;
+    next = node->parent();
+    while (next != nullptr && next->template child<forward>() == node) {
+      node = next;
+      next = next->parent();
     }
-    if (!found) next = end_;
-    return std::pair<Node<key_type, value_type> *, bool>(next, found);
+    current_ = next != nullptr ? next : end_;
+  }
+
+  static tree_node *FindRoot(tree_node *node) noexcept {
+    while (node->parent() != nullptr) node = node->parent();
+    return node;
   }
 
   TreeIterator MoveIterator(const size_type count, bool forward) noexcept {
-    std::pair<Node<key_type, value_type> *, bool> p = GetNext(!forward);
-    for (size_type i = 1; i < count && p.second; i++) {
-      current_ = p.first;
-      p = GetNext(!forward);
+    if constexpr (order_statistics) {
+      // jump by position instead of stepping; end() past either edge
+      size_type from = index();
+      tree_node *max = end_->parent();
+      tree_node *root = max == nullptr ? nullptr : FindRoot(max);
+      TreeIterator it(*this);
+      if (root != nullptr &&
+          (forward ? count < SubtreeSizeOf(root) - from : count <= from)) {
+        it.SetNode(SelectNode(root, forward ? from + count : from - count));
+      } else {
+        it.SetNode(end_);
+      }
+      return it;
     }
     TreeIterator it(*this);
-    it.SetNode(p.first);
+    size_type steps = 0;
+    do {
+      if (forward) {
+        it.template Step<true>();
+      } else {
+        it.template Step<false>();
+      }
+    } while (++steps < count && it.current_ != end_);
     return it;
   }
 };
 
-template <typename key_type, typename value_type = key_type>
-class TreeConstIterator : public TreeIterator<key_type, value_type> {
+template <typename key_type, typename value_type = KeyOnly,
+          bool order_statistics = false>
+class TreeConstIterator
+    : public TreeIterator<key_type, value_type, order_statistics> {
  public:
-  TreeConstIterator() noexcept : TreeIterator<key_type, value_type>() {}
-  TreeConstIterator(const Node<key_type, value_type> *root) noexcept
-      : TreeIterator<key_type, value_type>((Node<key_type, value_type> *)root) {
+  using base_iterator = TreeIterator<key_type, value_type, order_statistics>;
+  using tree_node = typename base_iterator::tree_node;
+
+  TreeConstIterator() noexcept : base_iterator() {}
+  TreeConstIterator(const tree_node *root) noexcept
+      : base_iterator((tree_node *)root) {
   }
-  const Node<key_type, value_type> *operator->() const noexcept {
-    return current_;
+  TreeConstIterator(const tree_node *current, const tree_node *end) noexcept
+      : base_iterator((tree_node *)current, (tree_node *)end) {}
+  TreeConstIterator(const base_iterator &other) noexcept
+      : base_iterator(other) {}
+  const tree_node *operator->() const noexcept {
+    return this->current_;
   }
-  const Node<key_type, value_type> *current_;
 };
 
+// O(log n) distance between iterators of an order-statistic tree
 template <typename key_type, typename value_type>
-class RBTree {
+std::ptrdiff_t distance(
+    const TreeIterator<key_type, value_type, true> &first,
+    const TreeIterator<key_type, value_type, true> &last) noexcept {
+  return static_cast<std::ptrdiff_t>(last.index()) -
+         static_cast<std::ptrdiff_t>(first.index());
+}
+
+// true for iterators whose traits promise multi-pass forward traversal
+template <typename It, typename = void>
+struct IsForwardIterator : std::false_type {};
+
+template <typename It>
+struct IsForwardIterator<
+    It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::is_base_of<std::forward_iterator_tag,
+                      typename std::iterator_traits<It>::iterator_category> {
+};
+
+// Holds the key ordering of a tree. An empty comparator such as std::less
+// is inherited rather than stored, so it adds nothing to the tree's size.
+template <typename Compare, bool = std::is_empty<Compare>::value &&
+                                   !std::is_final<Compare>::value>
+class KeyCompare : private Compare {
+ public:
+  KeyCompare() = default;
+  explicit KeyCompare(const Compare &comp) : Compare(comp) {}
+  const Compare &key_comp() const noexcept { return *this; }
+};
+
+template <typename Compare>
+class KeyCompare<Compare, false> {
  public:
+  KeyCompare() = default;
+  explicit KeyCompare(const Compare &comp) : comp_(comp) {}
+  const Compare &key_comp() const noexcept { return comp_; }
+
+ private:
+  Compare comp_ = Compare();
+};
+
+template <typename key_type, typename value_type,
+          typename Compare = std::less<key_type>,
+          bool order_statistics = false>
+class RBTree : private KeyCompare<Compare> {
+ public:
+  using tree_node = Node<key_type, value_type, order_statistics>;
+  using tree_iterator = TreeIterator<key_type, value_type, order_statistics>;
+  using pool_type = NodePool<tree_node>;
+  using key_compare = Compare;
+  using node_handle = NodeHandle<key_type, value_type, order_statistics>;
+
+  static_assert(alignof(tree_node) >= 2,
+                "the colour bit needs node addresses with a clear low bit");
+
   RBTree() noexcept : root_(nullptr), end_node_(), size_(0){};
-  RBTree(key_type key) {
-    root_ = new Node<key_type, value_type>(key);
-    root_->color_ = 'B';
-  }
-  RBTree(key_type key, value_type value) {
-    root_ = new Node<key_type, value_type>(key, value);
-    root_->color_ = 'B';
+  explicit RBTree(const Compare &comp)
+      : KeyCompare<Compare>(comp), root_(nullptr), end_node_(), size_(0){};
+  // nodes of every tree constructed with the same pool share its slabs
+  explicit RBTree(std::shared_ptr<pool_type> pool) noexcept
+      : root_(nullptr), end_node_(), pool_(std::move(pool)), size_(0){};
+  RBTree(key_type key, value_type value) : RBTree() {
+    root_ = CreateNode(key, value);
+    root_->set_color('B');
+    size_ = 1;
+    UpdateEnd();
   }
 
-  RBTree(const RBTree &other) { *this = other; }
+  RBTree(const RBTree &other) : KeyCompare<Compare>(other) { *this = other; }
 
-  RBTree(RBTree &&other) noexcept { *this = std::move(other); }
+  RBTree(RBTree &&other) noexcept : KeyCompare<Compare>(other) {
+    *this = std::move(other);
+  }
 
   RBTree &operator=(const RBTree &other) {
     if (this != &other) {
       clear();
+      KeyCompare<Compare>::operator=(other);
       size_ = other.size_;
       CopyNodeRecursively(root_, other.root_, nullptr);
       UpdateEnd();
@@ -172,13 +460,17 @@ class RBTree {
   RBTree &operator=(RBTree &&other) noexcept {
     if (this != &other) {
       clear();
+      KeyCompare<Compare>::operator=(other);
       root_ = other.root_;
       size_ = other.size_;
       end_node_ = other.end_node_;
+      leftmost_ = other.leftmost_;
+      pool_ = std::move(other.pool_);
 
       other.root_ = nullptr;
       other.size_ = 0;
-      other.end_node_ = Node<key_type, value_type>();
+      other.end_node_ = tree_node();
+      other.leftmost_ = nullptr;
     }
     return *this;
   }
@@ -189,141 +481,273 @@ class RBTree {
     size_ = 0;
   }
 
-  std::pair<Node<key_type, value_type> *, bool> insert(
-      key_type key, value_type value, bool add_only_unique_values) {
-    Node<key_type, value_type> *root = root_;
-    Node<key_type, value_type> *new_node_father = nullptr;
-
-    while (root != nullptr) {
-      new_node_father = root;
-      if (add_only_unique_values) {
-        if (key < root->key_) {
-          root = root->left_;
-        } else if (key > root->key_) {
-          root = root->right_;
-        } else {
-          return std::pair<Node<key_type, value_type> *, bool>(nullptr, false);
-        }
-      } else {
-        if (key <= root->key_) {
-          root = root->left_;
-        } else {
-          root = root->right_;
-        }
-      }
-    }
+  // on a rejected duplicate the node already holding key is returned
+  template <typename K, typename V>
+  std::pair<tree_node *, bool> insert(K &&key, V &&value,
+                                      bool add_only_unique_values) {
+    return InsertWithKey(key, add_only_unique_values, std::piecewise_construct,
+                         std::forward<K>(key), std::forward<V>(value));
+  }
 
-    Node<key_type, value_type> *new_node =
-        new Node<key_type, value_type>(key, value);
+  // inserts a key-only node, for set-style trees
+  template <typename K>
+  std::pair<tree_node *, bool> insert(K &&key, bool add_only_unique_values) {
+    return InsertWithKey(key, add_only_unique_values, std::piecewise_construct,
+                         std::forward<K>(key));
+  }
 
-    ++size_;
+  // Inserts next to hint, the node the new key should precede; see
+  // FindHintPosition for the cost.
+  template <typename K, typename... Args>
+  std::pair<tree_node *, bool> emplace_hint(
+      tree_node *hint, bool add_only_unique_values, K &&key, Args &&...args) {
+    return InsertAt(FindHintPosition(hint, key, add_only_unique_values),
+                    std::piecewise_construct, std::forward<K>(key),
+                    std::forward<Args>(args)...);
+  }
 
-    new_node->parent_ = new_node_father;
-    if (new_node->parent_ == nullptr)
-      root_ = new_node;
-    else if (new_node->key_ <= new_node_father->key_)
-      new_node_father->left_ = new_node;
-    else
-      new_node_father->right_ = new_node;
+  // unique insert that only builds value_ from args when key is absent
+  template <typename K, typename... Args>
+  std::pair<tree_node *, bool> try_emplace(K &&key, Args &&...args) {
+    return InsertWithKey(key, true, std::piecewise_construct,
+                         std::forward<K>(key), std::forward<Args>(args)...);
+  }
 
-    makeBalancedAfterInsert(new_node);
-    UpdateEnd();
-    return std::pair<Node<key_type, value_type> *, bool>(new_node, true);
+  // Replaces the contents with [first, last). Forward input that is already
+  // in key order, strictly so when duplicates are rejected, is linked into
+  // a perfectly balanced tree in O(n) with all nodes taken from one slab;
+  // any other input is inserted element by element.
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last, bool add_only_unique_values) {
+    clear();
+    std::size_t count = 0;
+    if constexpr (IsForwardIterator<InputIt>::value) {
+      if (IsSortedRange(first, last, add_only_unique_values, count)) {
+        BuildSorted(first, count);
+        return;
+      }
+    }
+    for (; first != last; ++first) {
+      InsertElement(*first, add_only_unique_values);
+    }
   }
 
   void erase(const key_type &key) {
-    Node<key_type, value_type> *node = FindNode(key);
+    tree_node *node = FindNode(key);
     if (node) {
       eraseNode(node);
     }
   }
 
-  void erase(TreeIterator<key_type, value_type> pos) {
+  void erase(tree_iterator pos) {
     if (pos.current_ != &end_node_) {
       eraseNode(pos.current_);
     }
   }
 
+  // unlinks the node without destroying it; end() gives an empty handle
+  node_handle extract(tree_iterator pos) noexcept {
+    if (pos.current_ == &end_node_ || pos.current_ == nullptr) {
+      return node_handle();
+    }
+    UnlinkNode(pos.current_);
+    return node_handle(pos.current_, pool_);
+  }
+
+  node_handle extract(const key_type &key) noexcept {
+    tree_node *node = FindNode(key);
+    if (node == nullptr) return node_handle();
+    UnlinkNode(node);
+    return node_handle(node, pool_);
+  }
+
+  // Links the handle's node back in, emptying the handle; a rejected
+  // duplicate stays in the handle and the node holding its key is returned.
+  // Only a node whose pool is still used by yet another tree has to be
+  // moved into a fresh node, any other one is relinked as is.
+  std::pair<tree_node *, bool> insert_node(node_handle &&handle,
+                                           bool add_only_unique_values) {
+    if (handle.empty()) {
+      return std::pair<tree_node *, bool>(&end_node_, false);
+    }
+    tree_node *node = handle.node_;
+    InsertPosition place = FindInsertParent(node->key_, add_only_unique_values);
+    if (place.found) {
+      return std::pair<tree_node *, bool>(place.node, false);
+    }
+    if (!SharePool(handle.pool_)) {
+      std::pair<tree_node *, bool> res = MoveIntoNewNode(place, node);
+      handle.reset();
+      return res;
+    }
+    handle.node_ = nullptr;
+    handle.pool_.reset();
+    RelinkNode(node, place);
+    return std::pair<tree_node *, bool>(node, true);
+  }
+
+  // Moves every node of other whose key is not present yet (any node at
+  // all for a multi-tree) into this tree by relinking it: nothing is
+  // allocated or copied unless other's pool is also used by a third tree.
+  void merge(RBTree &other, bool add_only_unique_values) {
+    if (&other == this || other.root_ == nullptr) return;
+    bool relink = SharePool(other.pool_);
+    tree_node *next = nullptr;
+    for (tree_node *node = other.leftmost_; node != nullptr;
+         node = next) {
+      next = NextNode(node);
+      InsertPosition place =
+          FindInsertParent(node->key_, add_only_unique_values);
+      if (place.found) continue;
+      if (relink) {
+        other.UnlinkNode(node);
+        RelinkNode(node, place);
+      } else {
+        MoveIntoNewNode(place, node);
+        other.eraseNode(node);
+      }
+    }
+  }
+
+  // a pool owned by this tree alone is dropped slab by slab; a shared pool
+  // only gets the nodes back on its free list
   void clear() noexcept {
-    ClearRecursively(root_);
+    if (pool_ != nullptr && pool_.use_count() == 1) {
+      if (!std::is_trivially_destructible<tree_node>::value)
+        DestroyRecursively(root_);
+      pool_->release();
+    } else {
+      ClearRecursively(root_);
+    }
     root_ = nullptr;
+    size_ = 0;
     UpdateEnd();
   }
 
+  std::shared_ptr<pool_type> get_pool() const noexcept { return pool_; }
+
   std::size_t size() const noexcept { return size_; }
   std::size_t max_size() const noexcept {
-    return LONG_MAX / sizeof(Node<key_type, value_type>);
+    return LONG_MAX / sizeof(tree_node);
   }
 
+  // recomputes the cached extremes from scratch, for bulk rebuilds only
   void UpdateEnd() noexcept {
-    end_node_.parent_ = findMax(root_);
-    end_node_.left_ = end_node_.parent_;
-    end_node_.right_ = end_node_.parent_;
+    leftmost_ = findMin(root_);
+    SetRightmost(findMax(root_));
   }
 
-  TreeIterator<key_type, value_type> find(const key_type &key) noexcept {
-    Node<key_type, value_type> *node = FindNode(key);
-    node = node ? FindFirstOccurrence(node) : &end_node_;
-    TreeIterator<key_type, value_type> it(node, &end_node_);
-    return it;
+  const Compare &key_comp() const noexcept {
+    return KeyCompare<Compare>::key_comp();
   }
 
-  TreeIterator<key_type, value_type> lower_bound(const key_type &key) {
-    auto it = begin();
-    for (; it != end() && *it < key; ++it)
-      ;
+  // Lookups take any key type the comparator accepts; the containers only
+  // forward keys other than key_type when Compare is transparent.
+  template <typename K>
+  tree_iterator find(const K &key) noexcept {
+    tree_iterator it = lower_bound(key);
+    if (it.current_ != &end_node_ && key_comp()(key, it.current_->key_)) {
+      it.SetNode(&end_node_);
+    }
     return it;
   }
 
-  TreeIterator<key_type, value_type> upper_bound(const key_type &key) {
-    auto it = begin();
-    for (; it != end() && *it <= key; ++it)
-      ;
-    return it;
+  // first node with key_ >= key, found by a single root-to-leaf descent
+  template <typename K>
+  tree_iterator lower_bound(const K &key) noexcept {
+    tree_node *node = root_;
+    tree_node *result = &end_node_;
+    while (node != nullptr) {
+      if (key_comp()(node->key_, key)) {
+        node = node->right_;
+      } else {
+        result = node;
+        node = node->left_;
+      }
+    }
+    return tree_iterator(result, &end_node_);
   }
 
-  Node<key_type, value_type> *FindFirstOccurrence(
-      Node<key_type, value_type> *node) {
-    key_type key = node->key_;
-    TreeIterator<key_type, value_type> temp(node, &end_node_);
-    for (; temp != begin() && temp.current_->key_ == key; --temp)
-      ;
-    if (temp.current_->key_ == key) {
-      node = temp.current_;
-    } else {
-      node = (temp + 1).current_;
+  // first node with key_ > key, found by a single root-to-leaf descent
+  template <typename K>
+  tree_iterator upper_bound(const K &key) noexcept {
+    tree_node *node = root_;
+    tree_node *result = &end_node_;
+    while (node != nullptr) {
+      if (key_comp()(key, node->key_)) {
+        result = node;
+        node = node->left_;
+      } else {
+        node = node->right_;
+      }
     }
-    return node;
+    return tree_iterator(result, &end_node_);
+  }
+
+  template <typename K>
+  std::pair<tree_iterator, tree_iterator> equal_range(const K &key) noexcept {
+    return std::pair<tree_iterator, tree_iterator>(lower_bound(key),
+                                                   upper_bound(key));
   }
 
-  std::size_t count(const key_type &key) {
-    std::size_t result = 0;
-    auto it = find(key);
+  // O(log n) from the ranks of both bounds in an order-statistic tree;
+  // otherwise O(log n + k) for k equal keys, as the range has to be walked
+  template <typename K>
+  std::size_t count(const K &key) noexcept {
+    if constexpr (order_statistics) {
+      return RankAfter(key) - rank(key);
+    } else {
+      std::size_t result = 0;
+      auto range = equal_range(key);
 
-    for (; it != end() && *it == key; ++it, ++result)
-      ;
+      for (; range.first != range.second; ++range.first, ++result)
+        ;
 
-    return result;
+      return result;
+    }
   }
 
-  bool contains(const key_type &key) const noexcept {
-    Node<key_type, value_type> *node = FindNode(key);
+  template <typename K>
+  bool contains(const K &key) const noexcept {
+    tree_node *node = FindNode(key);
     return node != nullptr;
   }
 
-  TreeIterator<key_type, value_type> begin() noexcept {
-    Node<key_type, value_type> *min = findMin(root_);
-    min = min == nullptr ? &end_node_ : min;
-    return TreeIterator<key_type, value_type>(min, &end_node_);
+  // the element at in-order position index, end() when there is none
+  tree_iterator nth(std::size_t index) noexcept {
+    static_assert(order_statistics, "nth() needs an order-statistic tree");
+    if (index >= size_) return end();
+    return tree_iterator(SelectNode(root_, index), &end_node_);
+  }
+
+  // number of elements ordered before key
+  template <typename K>
+  std::size_t rank(const K &key) const noexcept {
+    static_assert(order_statistics, "rank() needs an order-statistic tree");
+    std::size_t rank = 0;
+    for (const tree_node *node = root_; node != nullptr;) {
+      if (key_comp()(node->key_, key)) {
+        rank += SubtreeSizeOf(node->left_) + 1;
+        node = node->right_;
+      } else {
+        node = node->left_;
+      }
+    }
+    return rank;
+  }
+
+  tree_iterator begin() noexcept {
+    tree_node *min = leftmost_ == nullptr ? &end_node_ : leftmost_;
+    return tree_iterator(min, &end_node_);
   }
 
-  TreeIterator<key_type, value_type> end() noexcept {
-    return TreeIterator<key_type, value_type>(&end_node_, &end_node_);
+  tree_iterator end() noexcept {
+    return tree_iterator(&end_node_, &end_node_);
   }
 
   void swap(RBTree &other) noexcept {
-    Node<key_type, value_type> *tmp_node = root_;
-    Node<key_type, value_type> tmp_end = end_node_;
+    tree_node *tmp_node = root_;
+    tree_node tmp_end = end_node_;
     std::size_t tmp_size = size_;
 
     root_ = other.root_;
@@ -334,285 +758,643 @@ class RBTree {
 
     end_node_ = other.end_node_;
     other.end_node_ = tmp_end;
+
+    std::swap(leftmost_, other.leftmost_);
+    pool_.swap(other.pool_);
+    std::swap(static_cast<KeyCompare<Compare> &>(*this),
+              static_cast<KeyCompare<Compare> &>(other));
   }
 
-  Node<key_type, value_type> *root_ = nullptr;
-  Node<key_type, value_type> end_node_;
+  tree_node *root_ = nullptr;
+  tree_node end_node_;
 
  private:
-  void CopyNodeRecursively(Node<key_type, value_type> *&dst,
-                           const Node<key_type, value_type> *src,
-                           Node<key_type, value_type> *parent) {
+  // Where a new key goes: the free child slot of node on the given side,
+  // or, when found is set, nowhere because node already holds the key.
+  struct InsertPosition {
+    tree_node *node;
+    bool insert_left;
+    bool found;
+  };
+
+  template <typename... Args>
+  std::pair<tree_node *, bool> InsertWithKey(
+      const key_type &key, bool add_only_unique_values, Args &&...node_args) {
+    return InsertAt(FindInsertParent(key, add_only_unique_values),
+                    std::forward<Args>(node_args)...);
+  }
+
+  template <typename... Args>
+  std::pair<tree_node *, bool> InsertAt(const InsertPosition &place,
+                                        Args &&...node_args) {
+    if (place.found) {
+      return std::pair<tree_node *, bool>(place.node, false);
+    }
+    tree_node *new_node = CreateNode(std::forward<Args>(node_args)...);
+    LinkNewNode(new_node, place.node, place.insert_left);
+    return std::pair<tree_node *, bool>(new_node, true);
+  }
+
+  // Descends to the leaf position for key with one comparison per level;
+  // equal keys go right, so duplicates keep their insertion order. When
+  // duplicates are rejected, a node already holding key can only be the
+  // last one the descent stepped right from, which one more comparison
+  // checks.
+  InsertPosition FindInsertParent(const key_type &key,
+                                  bool add_only_unique_values) const noexcept {
+    tree_node *root = root_;
+    tree_node *new_node_father = nullptr;
+    tree_node *not_greater = nullptr;
+    bool insert_left = false;
+
+    while (root != nullptr) {
+      new_node_father = root;
+      insert_left = key_comp()(key, root->key_);
+      if (insert_left) {
+        root = root->left_;
+      } else {
+        not_greater = root;
+        root = root->right_;
+      }
+    }
+    if (add_only_unique_values && not_greater != nullptr &&
+        !key_comp()(not_greater->key_, key)) {
+      return InsertPosition{not_greater, false, true};
+    }
+    return InsertPosition{new_node_father, insert_left, false};
+  }
+
+  // Checks that key belongs right before hint, next to hint's in-order
+  // predecessor, and takes the free child slot between the two, or right
+  // after hint when key is greater. Only hint and one neighbour are
+  // compared, so a correct hint costs amortized O(1); any other hint falls
+  // back to the descent from the root.
+  InsertPosition FindHintPosition(tree_node *hint, const key_type &key,
+                                  bool add_only_unique_values) const noexcept {
+    bool unique = add_only_unique_values;
+    tree_node *rightmost = end_node_.parent();
+    if (hint == &end_node_) {
+      if (rightmost == nullptr) return InsertPosition{nullptr, false, false};
+      if (unique ? key_comp()(rightmost->key_, key)
+                 : !key_comp()(key, rightmost->key_)) {
+        return InsertPosition{rightmost, false, false};
+      }
+    } else if (unique ? key_comp()(key, hint->key_)
+                      : !key_comp()(hint->key_, key)) {
+      if (hint == leftmost_) return InsertPosition{hint, true, false};
+      tree_node *before = PrevNode(hint);
+      if (unique ? key_comp()(before->key_, key)
+                 : !key_comp()(key, before->key_)) {
+        // the predecessor has no right child or hint has no left one
+        if (before->right_ == nullptr) {
+          return InsertPosition{before, false, false};
+        }
+        return InsertPosition{hint, true, false};
+      }
+    } else if (unique && !key_comp()(hint->key_, key)) {
+      return InsertPosition{hint, false, true};
+    } else {
+      if (hint == rightmost) return InsertPosition{hint, false, false};
+      tree_node *after = NextNode(hint);
+      if (unique ? key_comp()(key, after->key_)
+                 : !key_comp()(after->key_, key)) {
+        if (hint->right_ == nullptr) return InsertPosition{hint, false, false};
+        return InsertPosition{after, true, false};
+      }
+    }
+    return FindInsertParent(key, add_only_unique_values);
+  }
+
+  static tree_node *PrevNode(tree_node *node) noexcept {
+    if (node->left_ != nullptr) return findMax(node->left_);
+    tree_node *parent = node->parent();
+    while (parent != nullptr && node == parent->left_) {
+      node = parent;
+      parent = parent->parent();
+    }
+    return parent;
+  }
+
+  static tree_node *NextNode(tree_node *node) noexcept {
+    if (node->right_ != nullptr) return findMin(node->right_);
+    tree_node *parent = node->parent();
+    while (parent != nullptr && node == parent->right_) {
+      node = parent;
+      parent = parent->parent();
+    }
+    return parent;
+  }
+
+  void LinkNewNode(tree_node *new_node, tree_node *new_node_father,
+                   bool insert_left) noexcept {
+    ++size_;
+
+    new_node->set_parent(new_node_father);
+    if (new_node->parent() == nullptr) {
+      root_ = new_node;
+      leftmost_ = new_node;
+      SetRightmost(new_node);
+    } else if (insert_left) {
+      new_node_father->left_ = new_node;
+      if (new_node_father == leftmost_) leftmost_ = new_node;
+    } else {
+      new_node_father->right_ = new_node;
+      if (new_node_father == end_node_.parent()) SetRightmost(new_node);
+    }
+
+    if constexpr (order_statistics) {
+      new_node->subtree_size_ = 1;
+      for (tree_node *up = new_node_father; up != nullptr; up = up->parent()) {
+        ++up->subtree_size_;
+      }
+    }
+
+    // rotations keep the in-order sequence, so the cached extremes stay valid
+    makeBalancedAfterInsert(new_node);
+  }
+
+  // keys of set-style elements are the elements, map elements are pairs
+  template <typename Element>
+  static const auto &KeyOf(const Element &element) noexcept {
+    if constexpr (std::is_same<value_type, KeyOnly>::value) {
+      return element;
+    } else {
+      return element.first;
+    }
+  }
+
+  template <typename Element>
+  void InsertElement(const Element &element, bool add_only_unique_values) {
+    if constexpr (std::is_same<value_type, KeyOnly>::value) {
+      insert(element, add_only_unique_values);
+    } else {
+      insert(element.first, element.second, add_only_unique_values);
+    }
+  }
+
+  template <typename Element>
+  tree_node *CreateNodeFrom(const Element &element) {
+    if constexpr (std::is_same<value_type, KeyOnly>::value) {
+      return CreateNode(std::piecewise_construct, element);
+    } else {
+      return CreateNode(std::piecewise_construct, element.first,
+                        element.second);
+    }
+  }
+
+  // counts [first, last) and tells whether its keys are ascending
+  template <typename ForwardIt>
+  bool IsSortedRange(ForwardIt first, ForwardIt last,
+                     bool add_only_unique_values, std::size_t &count) const {
+    count = 0;
+    for (ForwardIt prev = first; first != last; prev = first) {
+      ++count;
+      if (++first == last) break;
+      const auto &key = KeyOf(*first);
+      const auto &prev_key = KeyOf(*prev);
+      if (add_only_unique_values ? !key_comp()(prev_key, key)
+                                 : key_comp()(key, prev_key)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // links count sorted elements into an empty tree
+  template <typename ForwardIt>
+  void BuildSorted(ForwardIt first, std::size_t count) {
+    if (count == 0) return;
+    if (pool_ == nullptr) pool_ = std::make_shared<pool_type>();
+    pool_->reserve(count);
+    std::size_t red_depth = 0;
+    for (std::size_t n = count; n > 1; n >>= 1) ++red_depth;
+    root_ = BuildBalanced(first, count, 0, red_depth);
+    size_ = count;
+    UpdateEnd();
+  }
+
+  // Builds the subtree of the next count elements, splitting them in
+  // halves so that every leaf sits on one of the two deepest levels. The
+  // deepest level is coloured red, which gives every path the same number
+  // of black nodes. A throwing element constructor leaves nothing behind.
+  template <typename ForwardIt>
+  tree_node *BuildBalanced(ForwardIt &it, std::size_t count,
+                           std::size_t depth, std::size_t red_depth) {
+    if (count == 0) return nullptr;
+    std::size_t left_count = (count - 1) / 2;
+    tree_node *left = BuildBalanced(it, left_count, depth + 1, red_depth);
+    tree_node *node = nullptr;
+    try {
+      node = CreateNodeFrom(*it);
+    } catch (...) {
+      ClearRecursively(left);
+      throw;
+    }
+    ++it;
+    node->left_ = left;
+    if (left != nullptr) left->set_parent(node);
+    try {
+      node->right_ =
+          BuildBalanced(it, count - 1 - left_count, depth + 1, red_depth);
+    } catch (...) {
+      ClearRecursively(node);
+      throw;
+    }
+    if (node->right_ != nullptr) node->right_->set_parent(node);
+    node->set_color(depth == red_depth && depth != 0 ? 'R' : 'B');
+    if constexpr (order_statistics) node->subtree_size_ = count;
+    return node;
+  }
+
+  // end_node_.parent() doubles as the cached rightmost node
+  void SetRightmost(tree_node *node) noexcept {
+    end_node_.set_parent(node);
+    end_node_.left_ = node;
+    end_node_.right_ = node;
+  }
+
+  void CopyNodeRecursively(tree_node *&dst, const tree_node *src,
+                           tree_node *parent) {
     if (src) {
-      dst = new Node<key_type, value_type>(*src);
-      dst->parent_ = parent;
+      dst = CreateNode(*src);
+      dst->set_parent(parent);
       CopyNodeRecursively(dst->left_, src->left_, dst);
       CopyNodeRecursively(dst->right_, src->right_, dst);
     }
   }
 
-  void leftRotate(Node<key_type, value_type> *node) noexcept {
-    Node<key_type, value_type> *child = node->right_;
-    if (child != nullptr) child->parent_ = node->parent_;
+  void leftRotate(tree_node *node) noexcept {
+    tree_node *child = node->right_;
+    if (child != nullptr) child->set_parent(node->parent());
 
-    if (node->parent_ != nullptr) {
-      if (node->parent_->left_ == node) {
-        node->parent_->left_ = child;
+    if (node->parent() != nullptr) {
+      if (node->parent()->left_ == node) {
+        node->parent()->left_ = child;
       } else {
-        node->parent_->right_ = child;
+        node->parent()->right_ = child;
       }
     }
     node->right_ = child != nullptr ? child->left_ : nullptr;
     if (child != nullptr && child->left_ != nullptr)
-      child->left_->parent_ = node;
+      child->left_->set_parent(node);
 
-    node->parent_ = child;
+    node->set_parent(child);
     if (child != nullptr) child->left_ = node;
-    if (child != nullptr && child->parent_ == nullptr) root_ = child;
+    if (child != nullptr && child->parent() == nullptr) root_ = child;
+    if (child != nullptr) MoveSubtreeSize(node, child);
   }
 
-  void rightRotate(Node<key_type, value_type> *node) noexcept {
-    Node<key_type, value_type> *child = node->left_;
+  void rightRotate(tree_node *node) noexcept {
+    tree_node *child = node->left_;
 
-    if (child != nullptr) child->parent_ = node->parent_;
+    if (child != nullptr) child->set_parent(node->parent());
 
-    if (node->parent_ != nullptr) {
-      if (node->parent_->left_ == node) {
-        node->parent_->left_ = child;
+    if (node->parent() != nullptr) {
+      if (node->parent()->left_ == node) {
+        node->parent()->left_ = child;
       } else {
-        node->parent_->right_ = child;
+        node->parent()->right_ = child;
       }
     }
 
     node->left_ = child != nullptr ? child->right_ : nullptr;
     if (child != nullptr && child->right_ != nullptr) {
-      child->right_->parent_ = node;
+      child->right_->set_parent(node);
     }
 
-    node->parent_ = child;
+    node->set_parent(child);
     if (child != nullptr) child->right_ = node;
-    if (child != nullptr && child->parent_ == nullptr) root_ = child;
+    if (child != nullptr && child->parent() == nullptr) root_ = child;
+    if (child != nullptr) MoveSubtreeSize(node, child);
   }
 
   // rebalance insert
-  void makeBalancedAfterInsert(Node<key_type, value_type> *node) noexcept {
-    while (node->parent_ != nullptr && node->parent_->color_ == 'R') {
+  void makeBalancedAfterInsert(tree_node *node) noexcept {
+    while (node->parent() != nullptr && node->parent()->color() == 'R') {
       // left subtree
-      if (node->parent_ == node->parent_->parent_->left_) {
-        Node<key_type, value_type> *uncle = node->parent_->parent_->right_;
+      if (node->parent() == node->parent()->parent()->left_) {
+        tree_node *uncle = node->parent()->parent()->right_;
         // case 1: uncle(R)
-        if (uncle != nullptr && uncle->color_ == 'R') {
-          node->parent_->color_ = 'B';
-          uncle->color_ = 'B';
-          node->parent_->parent_->color_ = 'R';
-          node = node->parent_->parent_;
+        if (uncle != nullptr && uncle->color() == 'R') {
+          node->parent()->set_color('B');
+          uncle->set_color('B');
+          node->parent()->parent()->set_color('R');
+          node = node->parent()->parent();
         } else {  // case 2: uncle(B) or uncle is not exists
-          if (node == node->parent_->right_) {
+          if (node == node->parent()->right_) {
             // case 2.1: node is right child -> leftRotate subtree
-            node = node->parent_;
+            node = node->parent();
             leftRotate(node);
           }  // case 2 main part -> rightRotate subtree
-          node->parent_->color_ = 'B';
-          node->parent_->parent_->color_ = 'R';
-          rightRotate(node->parent_->parent_);
+          node->parent()->set_color('B');
+          node->parent()->parent()->set_color('R');
+          rightRotate(node->parent()->parent());
         }
       } else {  // right subtree (leftRotate <-> rightRotate)
-        Node<key_type, value_type> *uncle = node->parent_->parent_->left_;
-        if (uncle != nullptr && uncle->color_ == 'R') {
-          node->parent_->color_ = 'B';
-          uncle->color_ = 'B';
-          node->parent_->parent_->color_ = 'R';
-          node = node->parent_->parent_;
+        tree_node *uncle = node->parent()->parent()->left_;
+        if (uncle != nullptr && uncle->color() == 'R') {
+          node->parent()->set_color('B');
+          uncle->set_color('B');
+          node->parent()->parent()->set_color('R');
+          node = node->parent()->parent();
         } else {
-          if (node == node->parent_->left_) {
-            node = node->parent_;
+          if (node == node->parent()->left_) {
+            node = node->parent();
             rightRotate(node);
           }
-          node->parent_->color_ = 'B';
-          node->parent_->parent_->color_ = 'R';
-          leftRotate(node->parent_->parent_);
+          node->parent()->set_color('B');
+          node->parent()->parent()->set_color('R');
+          leftRotate(node->parent()->parent());
         }
       }
     }
-    root_->color_ = 'B';
+    root_->set_color('B');
   }
 
-  void swapNodes(Node<key_type, value_type> *node1,
-                 Node<key_type, value_type> *node2) noexcept {
-    if (node1->parent_ == nullptr)
+  void swapNodes(tree_node *node1, tree_node *node2) noexcept {
+    if (node1->parent() == nullptr)
       root_ = node2;
-    else if (node1 == node1->parent_->left_) {
-      node1->parent_->left_ = node2;
+    else if (node1 == node1->parent()->left_) {
+      node1->parent()->left_ = node2;
     } else {
-      node1->parent_->right_ = node2;
+      node1->parent()->right_ = node2;
     }
     if (node2 != nullptr) {
-      node2->parent_ = node1->parent_;
+      node2->set_parent(node1->parent());
+    }
+  }
+
+  void eraseNode(tree_node *node) noexcept {
+    UnlinkNode(node);
+    DestroyNode(node);
+  }
+
+  // Lets this tree own nodes whose memory comes from source. That holds
+  // when source is this tree's pool, when this tree has no pool yet and
+  // adopts source, or when nobody else uses source any more: its slabs
+  // are absorbed and source is pointed at this tree's pool. False when
+  // the nodes have to be moved into nodes of this tree instead.
+  bool SharePool(std::shared_ptr<pool_type> &source) noexcept {
+    if (source == pool_) return true;
+    if (pool_ == nullptr) {
+      pool_ = source;
+      return true;
+    }
+    if (source.use_count() == 1) {
+      pool_->absorb(*source);
+      source = pool_;
+      return true;
+    }
+    return false;
+  }
+
+  // puts an unlinked node into the free slot found for its key
+  void RelinkNode(tree_node *node, const InsertPosition &place) noexcept {
+    node->left_ = nullptr;
+    node->right_ = nullptr;
+    node->set_color('R');
+    LinkNewNode(node, place.node, place.insert_left);
+  }
+
+  // fallback for nodes from a pool in use elsewhere
+  std::pair<tree_node *, bool> MoveIntoNewNode(const InsertPosition &place,
+                                               tree_node *node) {
+    if constexpr (std::is_same<value_type, KeyOnly>::value) {
+      return InsertAt(place, std::piecewise_construct, std::move(node->key_));
+    } else {
+      return InsertAt(place, std::piecewise_construct, std::move(node->key_),
+                      std::move(node->value_));
     }
   }
 
-  void eraseNode(Node<key_type, value_type> *&node) noexcept {
-    Node<key_type, value_type> *new_root_subtree = node;
-    Node<key_type, value_type> *new_root_subtree_child = nullptr;
+  // takes node out of the tree and rebalances, leaving node itself intact
+  void UnlinkNode(tree_node *node) noexcept {
+    if constexpr (order_statistics) {
+      // every ancestor of the slot that disappears loses one descendant:
+      // node's own slot, or its successor's when the successor moves up
+      tree_node *removed = node;
+      if (node->left_ != nullptr && node->right_ != nullptr) {
+        removed = findMin(node->right_);
+      }
+      for (tree_node *up = removed->parent(); up != nullptr;
+           up = up->parent()) {
+        --up->subtree_size_;
+      }
+    }
 
-    char erased_node_color = node->color_;
+    // the in-order neighbour of an extreme node becomes the new extreme
+    if (node == leftmost_) {
+      leftmost_ =
+          node->right_ != nullptr ? findMin(node->right_) : node->parent();
+    }
+    if (node == end_node_.parent()) {
+      SetRightmost(node->left_ != nullptr ? findMax(node->left_)
+                                          : node->parent());
+    }
+
+    // child takes the place of the unlinked node, possibly as a null leaf,
+    // so its parent is tracked separately
+    tree_node *child = nullptr;
+    tree_node *child_parent = nullptr;
+    char erased_node_color = node->color();
 
     if (node->left_ == nullptr) {
-      new_root_subtree_child = node->right_;
+      child = node->right_;
+      child_parent = node->parent();
       swapNodes(node, node->right_);
     } else if (node->right_ == nullptr) {
-      new_root_subtree_child = node->left_;
+      child = node->left_;
+      child_parent = node->parent();
       swapNodes(node, node->left_);
     } else {
-      if (node->right_ != nullptr)
-        new_root_subtree = findMin(node->right_);
-      else
-        new_root_subtree = findMax(node->left_);
-      erased_node_color = new_root_subtree->color_;
-      new_root_subtree_child = new_root_subtree->right_;
-      if (new_root_subtree->parent_ == node &&
-          new_root_subtree_child != nullptr) {
-        new_root_subtree_child->parent_ = new_root_subtree;
+      tree_node *successor = findMin(node->right_);
+      erased_node_color = successor->color();
+      child = successor->right_;
+      if (successor->parent() == node) {
+        child_parent = successor;
       } else {
-        swapNodes(new_root_subtree, new_root_subtree->right_);
-        new_root_subtree->right_ = node->right_;
-        if (new_root_subtree->right_ != nullptr)
-          new_root_subtree->right_->parent_ = new_root_subtree;
+        child_parent = successor->parent();
+        swapNodes(successor, successor->right_);
+        successor->right_ = node->right_;
+        successor->right_->set_parent(successor);
+      }
+      swapNodes(node, successor);
+      successor->left_ = node->left_;
+      successor->left_->set_parent(successor);
+      successor->set_color(node->color());
+      if constexpr (order_statistics) {
+        successor->subtree_size_ = node->subtree_size_;
       }
-      swapNodes(node, new_root_subtree);
-      new_root_subtree->left_ = node->left_;
-      if (new_root_subtree->left_ != nullptr)
-        new_root_subtree->left_->parent_ = new_root_subtree;
-      new_root_subtree->color_ = node->color_;
     }
 
-    delete node;
     --size_;
-    if (erased_node_color == 'B') {
-      if (new_root_subtree_child != nullptr)
-        makeBalancedAfterErase(new_root_subtree_child);
-    }
-    UpdateEnd();
+    if (erased_node_color == 'B') makeBalancedAfterErase(child, child_parent);
   }
 
-  void makeBalancedAfterErase(Node<key_type, value_type> *&node) noexcept {
-    while (node != root_ && node->color_ == 'B') {
-      rebalanceCase1(node);
+  // after a rotation child heads the subtree node used to head
+  static void MoveSubtreeSize(tree_node *node, tree_node *child) noexcept {
+    if constexpr (order_statistics) {
+      child->subtree_size_ = node->subtree_size_;
+      node->subtree_size_ =
+          1 + SubtreeSizeOf(node->left_) + SubtreeSizeOf(node->right_);
     }
-    if (node != nullptr) node->color_ = 'B';
   }
 
-  void rebalanceCase1(
-      Node<key_type, value_type> *&node) noexcept {  // brother is red
-    Node<key_type, value_type> *brother = node->getBrother();
-    if (brother != nullptr && brother->color_ == 'R') {
-      brother->color_ = 'B';
-      if (node->parent_ != nullptr) node->parent_->color_ = 'R';
-      if (node == node->parent_->left_) {
-        leftRotate(node);
-        brother = node->parent_->right_;
-      } else {
-        rightRotate(node);
-        brother = node->parent_->left_;
-      }
-    }
-    rebalanceCase2(node);
+  static bool isBlack(const tree_node *node) noexcept {
+    return node == nullptr || node->color() == 'B';
   }
 
-  void rebalanceCase2(Node<key_type, value_type> *&node) noexcept {
-    Node<key_type, value_type> *brother = node->getBrother();
-    char P = node->parent_->color_;
-    char N = node->color_;
-    char S = brother != nullptr ? brother->color_ : 'B';
-
-    char Sl = 'N';
-    if (brother != nullptr) {
-      if (brother->left_ != nullptr)
-        Sl = brother->left_->color_;
-      else
-        Sl = 'B';
-    }
-    char Sr = 'N';
-    if (brother != nullptr) {
-      if (brother->right_ != nullptr)
-        Sr = brother->right_->color_;
-      else
-        Sr = 'B';
+  // rebalance erase: node carries an extra black and may be a null leaf
+  void makeBalancedAfterErase(tree_node *node, tree_node *parent) noexcept {
+    while (node != root_ && isBlack(node)) {
+      // left subtree
+      if (node == parent->left_) {
+        tree_node *brother = parent->right_;
+        // case 1: brother(R) -> rotate so that brother becomes black
+        if (brother->color() == 'R') {
+          brother->set_color('B');
+          parent->set_color('R');
+          leftRotate(parent);
+          brother = parent->right_;
+        }
+        if (isBlack(brother->left_) && isBlack(brother->right_)) {
+          // case 2: both nephews(B) -> push the extra black up
+          brother->set_color('R');
+          node = parent;
+          parent = node->parent();
+        } else {
+          if (isBlack(brother->right_)) {
+            // case 3: far nephew(B) -> rotate the near one outwards
+            brother->left_->set_color('B');
+            brother->set_color('R');
+            rightRotate(brother);
+            brother = parent->right_;
+          }
+          // case 4: far nephew(R) -> final rotation
+          brother->set_color(parent->color());
+          parent->set_color('B');
+          brother->right_->set_color('B');
+          leftRotate(parent);
+          node = root_;
+        }
+      } else {  // right subtree (leftRotate <-> rightRotate)
+        tree_node *brother = parent->left_;
+        if (brother->color() == 'R') {
+          brother->set_color('B');
+          parent->set_color('R');
+          rightRotate(parent);
+          brother = parent->left_;
+        }
+        if (isBlack(brother->left_) && isBlack(brother->right_)) {
+          brother->set_color('R');
+          node = parent;
+          parent = node->parent();
+        } else {
+          if (isBlack(brother->left_)) {
+            brother->right_->set_color('B');
+            brother->set_color('R');
+            leftRotate(brother);
+            brother = parent->left_;
+          }
+          brother->set_color(parent->color());
+          parent->set_color('B');
+          brother->left_->set_color('B');
+          rightRotate(parent);
+          node = root_;
+        }
+      }
     }
-
-    if (P == 'B' && N == 'B' && S == 'B' && Sl == 'B' && Sr == 'B') {
-      if (brother != nullptr) brother->color_ = 'R';
-      node = node->parent_;
-    } else
-      rebalanceCase3(node);
+    if (node != nullptr) node->set_color('B');
   }
 
-  void rebalanceCase3(Node<key_type, value_type> *&node) noexcept {
-    Node<key_type, value_type> *brother = node->getBrother();
-    if (brother != nullptr && brother->left_ != nullptr) {
-      brother->left_->color_ = 'B';
-      brother->color_ = 'R';
+  // number of elements not ordered after key, the rank of upper_bound(key)
+  template <typename K>
+  std::size_t RankAfter(const K &key) const noexcept {
+    std::size_t rank = 0;
+    for (const tree_node *node = root_; node != nullptr;) {
+      if (key_comp()(key, node->key_)) {
+        node = node->left_;
+      } else {
+        rank += SubtreeSizeOf(node->left_) + 1;
+        node = node->right_;
+      }
     }
-    if (node == node->parent_->left_)
-      rightRotate(brother);
-    else
-      leftRotate(brother);
-    brother = node->parent_->right_;
-    rebalanceCase4(node);
+    return rank;
   }
 
-  void rebalanceCase4(Node<key_type, value_type> *&node) noexcept {
-    Node<key_type, value_type> *brother = node->getBrother();
-    if (brother != nullptr) brother->color_ = node->parent_->color_;
-    if (node->parent_ != nullptr) node->parent_->color_ = 'B';
-    if (brother != nullptr && brother->right_ != nullptr)
-      brother->right_->color_ = 'B';
+  // lower_bound descent with one comparison per level, then one more to
+  // tell whether the candidate is equal to key
+  template <typename K>
+  tree_node *FindNode(const K &key) const noexcept {
+    tree_node *node = root_;
+    tree_node *candidate = nullptr;
 
-    if (node == node->parent_->left_)
-      leftRotate(node->parent_);
-    else
-      rightRotate(node->parent_);
-  }
-
-  Node<key_type, value_type> *FindNode(const key_type &key) const noexcept {
-    Node<key_type, value_type> *node = root_;
-
-    while (node && node->key_ != key) {
-      if (key > node->key_) {
+    while (node != nullptr) {
+      if (key_comp()(node->key_, key)) {
         node = node->right_;
       } else {
+        candidate = node;
         node = node->left_;
       }
     }
+    if (candidate != nullptr && key_comp()(key, candidate->key_)) {
+      candidate = nullptr;
+    }
+    return candidate;
+  }
 
-    return node;
+  template <typename... Args>
+  tree_node *CreateNode(Args &&...args) {
+    if (pool_ == nullptr) pool_ = std::make_shared<pool_type>();
+    void *place = pool_->allocate();
+    try {
+      return new (place)
+          tree_node(std::forward<Args>(args)...);
+    } catch (...) {
+      pool_->deallocate(place);
+      throw;
+    }
+  }
+
+  void DestroyNode(tree_node *node) noexcept {
+    node->~Node();
+    pool_->deallocate(node);
   }
 
-  void ClearRecursively(Node<key_type, value_type> *node) noexcept {
+  void ClearRecursively(tree_node *node) noexcept {
     if (node) {
       ClearRecursively(node->left_);
       ClearRecursively(node->right_);
-      delete node;
+      DestroyNode(node);
+    }
+  }
+
+  // runs node destructors only, the memory goes away with the slabs
+  void DestroyRecursively(tree_node *node) noexcept {
+    if (node) {
+      DestroyRecursively(node->left_);
+      DestroyRecursively(node->right_);
+      node->~Node();
     }
   }
 
-  Node<key_type, value_type> *findMin(
-      Node<key_type, value_type> *root) noexcept {
+  static tree_node *findMin(tree_node *root) noexcept {
     while (root && root->left_ != nullptr) {
       root = root->left_;
     }
     return root;
   }
 
-  Node<key_type, value_type> *findMax(
-      Node<key_type, value_type> *root) noexcept {
+  static tree_node *findMax(tree_node *root) noexcept {
     while (root && root->right_ != nullptr) {
       root = root->right_;
     }
     return root;
   }
 
-  std::size_t size_;
+  tree_node *leftmost_ = nullptr;
+  std::shared_ptr<pool_type> pool_;
+  std::size_t size_ = 0;
 };
 };  // namespace rbtree
 
@@ -9,4 +9,16 @@
 #include "array/s21_array.h"
 // -------------- -------- -------------- //
 
+#include "unordered_map/s21_unordered_map.h"
+#include "unordered_set/s21_unordered_set.h"
+
+#include "btree_map/s21_btree_map.h"
+#include "btree_multiset/s21_btree_multiset.h"
+#include "btree_set/s21_btree_set.h"
+#include "deque/s21_deque.h"
+#include "flat_map/s21_flat_map.h"
+#include "flat_set/s21_flat_set.h"
+#include "small_vector/s21_small_vector.h"
+#include "static_vector/s21_static_vector.h"
+
 #endif  // S21_CONTAINERS_S21_CONTAINERSPLUS_H_
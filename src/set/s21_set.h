@@ -2,6 +2,7 @@
 #define S21_CONTAINERS_S21_SET_SET_H_
 
 #include <climits>
+#include <functional>
 #include <initializer_list>
 #include <new>
 #include <stdexcept>
@@ -12,8 +13,16 @@
 namespace s21 {
 using namespace rbtree;
 
-template <typename Key>
+template <typename Key, typename Compare = std::less<Key>,
+          bool OrderStatistics = false>
 class set {
+  using tree_type = RBTree<Key, KeyOnly, Compare, OrderStatistics>;
+  using tree_iterator = typename tree_type::tree_iterator;
+  using tree_const_iterator = TreeConstIterator<Key, KeyOnly, OrderStatistics>;
+
+  template <typename C>
+  using if_transparent = typename C::is_transparent;
+
  public:
   class SetIterator;
   class SetConstIterator;
@@ -24,13 +33,23 @@ class set {
   using iterator = SetIterator;
   using const_iterator = SetConstIterator;
   using size_type = size_t;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using node_type = typename tree_type::node_handle;
+  using node_pool = typename tree_type::pool_type;
 
   // set member functions
   set() noexcept : rb() {}
+  explicit set(const Compare &comp) : rb(comp) {}
+  explicit set(std::shared_ptr<node_pool> pool) noexcept
+      : rb(std::move(pool)) {}
   set(std::initializer_list<value_type> const &items) {
-    for (const_reference value_ : items) {
-      rb.insert(value_, value_, true);
-    }
+    assign_sorted(items.begin(), items.end());
+  }
+  template <typename InputIt,
+            typename = decltype(*std::declval<InputIt &>())>
+  set(InputIt first, InputIt last) {
+    assign_sorted(first, last);
   }
   set(const set &s) { *this = s; }
   set(set &&s) noexcept { *this = std::move(s); }
@@ -54,19 +73,26 @@ class set {
   iterator begin() noexcept { return rb.begin(); }
   iterator end() noexcept { return rb.end(); }
 
-  class SetIterator : public TreeIterator<value_type> {
+  class SetIterator : public tree_iterator {
    public:
-    using TreeIterator<value_type>::TreeIterator;
-    SetIterator(const TreeIterator<value_type, key_type> &other)
+    using tree_iterator::tree_iterator;
+    SetIterator(const tree_iterator &other)
         : SetIterator(other.current_, other.end_) {}
   };
-  class SetConstIterator : public TreeConstIterator<value_type> {
+  class SetConstIterator : public tree_const_iterator {
    public:
-    using TreeConstIterator<value_type>::TreeConstIterator;
-    SetConstIterator(const TreeIterator<value_type, key_type> &other)
+    using tree_const_iterator::tree_const_iterator;
+    SetConstIterator(const tree_iterator &other)
         : SetConstIterator(other.current_, other.end_) {}
   };
 
+  // what inserting a node reports; node keeps a rejected duplicate
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
+
   // Capacity
   bool empty() const noexcept { return rb.root_ == nullptr; }
   size_type size() const noexcept { return rb.size(); }
@@ -75,18 +101,54 @@ class set {
   // Modifiers
   void clear() noexcept { rb.clear(); }
   std::pair<iterator, bool> insert(const value_type &value) {
-    std::pair<Node<value_type, key_type> *, bool> p;
-    p = rb.insert(value, value, true);
+    std::pair<typename tree_type::tree_node *, bool> p;
+    p = rb.insert(value, true);
     SetIterator it(p.first, &rb.end_node_);
     return std::pair<SetIterator, bool>(it, p.second);
   }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    std::pair<typename tree_type::tree_node *, bool> p;
+    p = rb.insert(std::move(value), true);
+    SetIterator it(p.first, &rb.end_node_);
+    return std::pair<SetIterator, bool>(it, p.second);
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+  // hinted insertion, amortized O(1) when the element belongs right
+  // before hint
+  iterator insert(const_iterator hint, const value_type &value) {
+    return iterator(rb.emplace_hint(hint.current_, true, value).first,
+                    &rb.end_node_);
+  }
+  iterator insert(const_iterator hint, value_type &&value) {
+    return iterator(
+        rb.emplace_hint(hint.current_, true, std::move(value)).first,
+        &rb.end_node_);
+  }
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args) {
+    return insert(hint, value_type(std::forward<Args>(args)...));
+  }
+  // replaces the contents; input already in key order is linked in O(n)
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    rb.assign(first, last, true);
+  }
   void erase(iterator pos) noexcept { rb.erase(pos); }
   void erase(const key_type &key) noexcept { rb.erase(key); }
   void swap(set &other) noexcept { rb.swap(other.rb); }
-  void merge(set &other) {
-    for (auto it : other) {
-      insert(it);
-    }
+  // relinks the nodes of other whose keys are missing here; duplicates
+  // stay behind in other
+  void merge(set &other) { rb.merge(other.rb, true); }
+  node_type extract(const_iterator pos) noexcept { return rb.extract(pos); }
+  node_type extract(const Key &key) noexcept { return rb.extract(key); }
+  insert_return_type insert(node_type &&node) {
+    std::pair<typename tree_type::tree_node *, bool> p =
+        rb.insert_node(std::move(node), true);
+    return insert_return_type{iterator(p.first, &rb.end_node_), p.second,
+                              std::move(node)};
   }
 
   template <typename... Args>
@@ -94,18 +156,33 @@ class set {
     vector<std::pair<iterator, bool>> res;
 
     res.reserve(sizeof...(args));
-    for (auto &&arg : {args...}) {
-      res.push_back(rb.insert(arg, arg, true));
-    }
+    (res.push_back(insert(std::forward<Args>(args))), ...);
     return res;
   }
 
   // Lookup
   iterator find(const Key &key) noexcept { return rb.find(key); }
+  // heterogeneous lookup, available when Compare is transparent
+  template <typename K, typename C = Compare, typename = if_transparent<C>>
+  iterator find(const K &key) noexcept {
+    return rb.find(key);
+  }
   bool contains(const Key &key) const noexcept { return rb.contains(key); }
+  template <typename K, typename C = Compare, typename = if_transparent<C>>
+  bool contains(const K &key) const noexcept {
+    return rb.contains(key);
+  }
+
+  // Order statistics, O(log n); need OrderStatistics set
+  iterator nth(size_type index) noexcept { return rb.nth(index); }
+  size_type rank(const Key &key) const noexcept { return rb.rank(key); }
+
+  // Observers
+  key_compare key_comp() const { return rb.key_comp(); }
+  value_compare value_comp() const { return rb.key_comp(); }
 
  private:
-  RBTree<value_type, key_type> rb;
+  tree_type rb;
 };
 };  // namespace s21
 
@@ -0,0 +1,278 @@
+#ifndef S21_CONTAINERS_S21_SMALL_VECTOR_SMALL_VECTOR_H_
+#define S21_CONTAINERS_S21_SMALL_VECTOR_SMALL_VECTOR_H_
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/s21_memory.h"
+
+namespace s21 {
+// s21::vector with room for N elements inside the object: it only
+// allocates once it outgrows that buffer, and returns to it when
+// shrink_to_fit finds the elements fit again. Moving a small_vector that
+// is still inline moves its elements one by one, so unlike vector's its
+// move constructor and swap are O(size) and invalidate iterators.
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class small_vector {
+ public:
+  // small_vector member type
+  using value_type = T;
+  using allocator_type = Allocator;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  // small_vector member functions
+  small_vector() noexcept(noexcept(Allocator()))
+      : start(inline_data()), finish(start), allocd(N), alloc() {}
+  explicit small_vector(const Allocator &a) noexcept
+      : start(inline_data()), finish(start), allocd(N), alloc(a) {}
+  explicit small_vector(size_type n, const Allocator &a = Allocator())
+      : small_vector(a) {
+    reserve(n);
+    try {
+      for (; finish != start + n; ++finish) {
+        alloc_traits::construct(alloc, finish);
+      }
+    } catch (...) {
+      free_storage();
+      throw;
+    }
+  }
+  small_vector(std::initializer_list<value_type> const &items,
+               const Allocator &a = Allocator())
+      : small_vector(a) {
+    reserve(items.size());
+    for (auto &item : items) {
+      push_back(item);
+    }
+  }
+  small_vector(const small_vector &v)
+      : small_vector(
+            alloc_traits::select_on_container_copy_construction(v.alloc)) {
+    *this = v;
+  }
+  small_vector(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible<value_type>::value)
+      : small_vector(v.alloc) {
+    steal(v);
+  }
+  ~small_vector() noexcept { free_storage(); }
+  small_vector &operator=(const small_vector &v) {
+    if (this != &v) {
+      clear();
+      if (allocd < v.size()) reserve(v.size());
+      finish = memory::uninitialized_copy(alloc, v.start, v.size(), start);
+    }
+    return *this;
+  }
+  small_vector &operator=(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible<value_type>::value) {
+    if (this != &v) {
+      free_storage();
+      alloc = std::move(v.alloc);
+      steal(v);
+    }
+    return *this;
+  }
+  allocator_type get_allocator() const noexcept { return alloc; }
+
+  // small_vector element access
+  reference at(size_type pos) const {
+    if (pos >= size()) {
+      throw std::out_of_range("pos is out of the scope");
+    } else {
+      return start[pos];
+    }
+  }
+  reference operator[](size_type pos) const noexcept { return start[pos]; }
+  const_reference front() const noexcept { return start[0]; }
+  const_reference back() const noexcept { return finish[-1]; }
+  iterator data() const noexcept { return start; }
+
+  // small_vector iterators
+  iterator begin() const noexcept { return start; }
+  iterator end() const noexcept { return finish; }
+
+  // small_vector capacity
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept { return finish - start; }
+  size_type max_size() const noexcept { return LONG_MAX / sizeof(value_type); }
+  // like vector::reserve, also shrinks to size; capacity never drops
+  // below the inline N
+  void reserve(size_type size) {
+    if (size < this->size()) return;
+    if (size <= N) {
+      if (!is_inline()) move_storage(inline_data(), N);
+    } else if (size != allocd) {
+      iterator new_v = alloc_traits::allocate(alloc, size);
+      try {
+        move_storage(new_v, size);
+      } catch (...) {
+        alloc_traits::deallocate(alloc, new_v, size);
+        throw;
+      }
+    }
+  }
+  size_type capacity() const noexcept { return allocd; }
+  void shrink_to_fit() { reserve(size()); }
+
+  // small_vector modifiers
+  void clear() noexcept {
+    memory::destroy(alloc, start, finish);
+    finish = start;
+  }
+  iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  iterator insert(iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type offset = pos - start;
+    if (finish == start + allocd) {
+      grow_and_construct(offset, std::forward<Args>(args)...);
+    } else {
+      memory::emplace_shift(alloc, start + offset, finish,
+                            std::forward<Args>(args)...);
+    }
+    return start + offset;
+  }
+  void erase(iterator pos) noexcept {
+    memory::erase_shift(alloc, pos, finish);
+    --finish;
+  }
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (finish == start + allocd) {
+      grow_and_construct(size(), std::forward<Args>(args)...);
+    } else {
+      alloc_traits::construct(alloc, finish, std::forward<Args>(args)...);
+      ++finish;
+    }
+    return finish[-1];
+  }
+  void pop_back() noexcept {
+    if (!empty()) {
+      --finish;
+      alloc_traits::destroy(alloc, finish);
+    }
+  }
+  void swap(small_vector &other) noexcept(
+      std::is_nothrow_move_constructible<value_type>::value) {
+    if (this == &other) return;
+    if (is_inline() || other.is_inline()) {
+      small_vector tmp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(tmp);
+    } else {
+      std::swap(start, other.start);
+      std::swap(finish, other.finish);
+      std::swap(allocd, other.allocd);
+      std::swap(alloc, other.alloc);
+    }
+  }
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    size_t offset = pos - start;
+    memory::pending_values<Allocator, value_type, sizeof...(Args)> values(
+        alloc, std::forward<Args>(args)...);
+    if (allocd < size() + sizeof...(args)) reserve(size() + sizeof...(args));
+    values.insert_at(start + offset, finish);
+    return start + offset;
+  }
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    insert_many(finish, std::forward<Args>(args)...);
+  }
+
+ private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  iterator start;
+  iterator finish;
+  size_type allocd;
+  allocator_type alloc;
+  alignas(T) unsigned char buffer[(N == 0 ? 1 : N) * sizeof(T)];
+
+  iterator inline_data() noexcept {
+    return reinterpret_cast<T *>(buffer);
+  }
+  bool is_inline() const noexcept {
+    return start == reinterpret_cast<const T *>(buffer);
+  }
+  void deallocate() noexcept {
+    if (!is_inline()) alloc_traits::deallocate(alloc, start, allocd);
+  }
+  // points back at the empty inline buffer, without freeing anything
+  void null() noexcept {
+    start = inline_data();
+    finish = start;
+    allocd = N;
+  }
+  void free_storage() noexcept {
+    memory::destroy(alloc, start, finish);
+    deallocate();
+    null();
+  }
+  // moves the elements to new_v, which holds new_allocd, and frees the old
+  // heap block; the elements stay put when relocating them throws
+  void move_storage(iterator new_v, size_type new_allocd) {
+    size_type old_size = size();
+    memory::relocate(alloc, start, old_size, new_v);
+    deallocate();
+    start = new_v;
+    finish = start + old_size;
+    allocd = new_allocd;
+  }
+  // takes over the heap block of v, or its inline elements one by one
+  void steal(small_vector &v) {
+    if (v.is_inline()) {
+      memory::relocate(alloc, v.start, v.size(), start);
+      finish = start + v.size();
+      v.finish = v.start;
+    } else {
+      start = v.start;
+      finish = v.finish;
+      allocd = v.allocd;
+      v.null();
+    }
+  }
+  size_type next_capacity() const noexcept {
+    if (allocd < 2) return allocd + 1;
+    return size() + size() / 2;
+  }
+  // Builds the new element straight into fresh storage before the old
+  // elements are moved over, so args may still refer into the old buffer.
+  template <typename... Args>
+  void grow_and_construct(size_type offset, Args &&...args) {
+    size_type new_allocd = next_capacity();
+    size_type old_size = size();
+    iterator new_v = alloc_traits::allocate(alloc, new_allocd);
+    try {
+      memory::construct_and_relocate(alloc, start, old_size, offset, new_v,
+                                     std::forward<Args>(args)...);
+    } catch (...) {
+      alloc_traits::deallocate(alloc, new_v, new_allocd);
+      throw;
+    }
+    deallocate();
+    start = new_v;
+    allocd = new_allocd;
+    finish = start + old_size + 1;
+  }
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_SMALL_VECTOR_SMALL_VECTOR_H_
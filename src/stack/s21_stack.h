@@ -1,9 +1,12 @@
 #ifndef S21_CONTAINERS_S21_STACK_H_
 #define S21_CONTAINERS_S21_STACK_H_
 
+#include "../deque/s21_deque.h"
 #include "../list/s21_list.h"
 namespace s21 {
-template <typename T, class Container = list<T>>
+// Container defaults to the ring-buffer deque; s21::list, or anything else
+// with the same members, can be passed instead.
+template <typename T, class Container = deque<T>>
 class stack {
   using value_type = T;
   using reference = T &;
@@ -11,32 +14,37 @@ class stack {
   using size_type = size_t;
 
  public:
-  stack() noexcept : list_() {}
-  stack(std::initializer_list<value_type> const &items) : list_(items) {}
-  stack(const stack &s) : list_(s.list_) {}
-  stack(stack &&s) noexcept : list_(std::move(s.list_)) {}
+  stack() noexcept : c_() {}
+  stack(std::initializer_list<value_type> const &items) : c_(items) {}
+  stack(const stack &s) : c_(s.c_) {}
+  stack(stack &&s) noexcept : c_(std::move(s.c_)) {}
   ~stack() noexcept {}
   stack &operator=(const stack &s) {
-    list_ = s.list_;
+    c_ = s.c_;
     return *this;
   }
   stack operator=(stack &&s) noexcept {
-    list_ = std::move(s.list_);
+    c_ = std::move(s.c_);
     return *this;
   }
-  const_reference top() const noexcept { return list_.back(); }
-  bool empty() const noexcept { return list_.empty(); }
-  size_type size() const noexcept { return list_.size(); }
-  void push(const_reference value) { list_.push_back(value); }
-  void pop() noexcept { list_.pop_back(); }
-  void swap(stack &other) noexcept { list_.swap(other.list_); }
+  const_reference top() const noexcept { return c_.back(); }
+  bool empty() const noexcept { return c_.empty(); }
+  size_type size() const noexcept { return c_.size(); }
+  void push(const_reference value) { c_.push_back(value); }
+  void push(value_type &&value) { c_.push_back(std::move(value)); }
+  template <class... Args>
+  void emplace(Args &&...args) {
+    c_.emplace_back(std::forward<Args>(args)...);
+  }
+  void pop() noexcept { c_.pop_back(); }
+  void swap(stack &other) noexcept { c_.swap(other.c_); }
   template <class... Args>
   void insert_many_front(Args &&...args) {
-    list_.insert_many_front(std::forward<Args>(args)...);
+    c_.insert_many_front(std::forward<Args>(args)...);
   }
 
  private:
-  Container list_;
+  Container c_;
 };
 }  // namespace s21
 
@@ -0,0 +1,239 @@
+#ifndef S21_CONTAINERS_S21_STATIC_VECTOR_STATIC_VECTOR_H_
+#define S21_CONTAINERS_S21_STATIC_VECTOR_STATIC_VECTOR_H_
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../memory/s21_memory.h"
+
+namespace s21 {
+// Vector with a fixed capacity of N elements stored inside the object; it
+// never allocates. Going past N is a precondition violation for the
+// modifiers, like an out-of-range operator[], so push_back stays noexcept;
+// try_push_back reports a full vector instead, and only the constructors,
+// at() and reserve() throw. For trivial types the whole interface except
+// insert, erase and swap works in constant expressions.
+template <typename T, std::size_t N>
+class static_vector {
+ public:
+  // static_vector member type
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+  using size_type = size_t;
+
+  // static_vector member functions
+  constexpr static_vector() noexcept = default;
+  constexpr explicit static_vector(size_type n) {
+    check_capacity(n);
+    while (size() != n) {
+      emplace_back();
+    }
+  }
+  constexpr static_vector(std::initializer_list<value_type> const &items) {
+    check_capacity(items.size());
+    for (auto &item : items) {
+      push_back(item);
+    }
+  }
+  constexpr static_vector(const static_vector &v) {
+    for (const_reference item : v) {
+      push_back(item);
+    }
+  }
+  constexpr static_vector(static_vector &&v) noexcept(
+      std::is_nothrow_move_constructible<value_type>::value) {
+    take(v);
+  }
+  constexpr static_vector &operator=(const static_vector &v) {
+    if (this != &v) {
+      clear();
+      for (const_reference item : v) {
+        push_back(item);
+      }
+    }
+    return *this;
+  }
+  constexpr static_vector &operator=(static_vector &&v) noexcept(
+      std::is_nothrow_move_constructible<value_type>::value) {
+    if (this != &v) {
+      clear();
+      take(v);
+    }
+    return *this;
+  }
+
+  // static_vector element access
+  constexpr reference at(size_type pos) {
+    if (pos >= size()) throw std::out_of_range("pos is out of the scope");
+    return data()[pos];
+  }
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= size()) throw std::out_of_range("pos is out of the scope");
+    return data()[pos];
+  }
+  constexpr reference operator[](size_type pos) noexcept {
+    return data()[pos];
+  }
+  constexpr const_reference operator[](size_type pos) const noexcept {
+    return data()[pos];
+  }
+  constexpr reference front() noexcept { return data()[0]; }
+  constexpr const_reference front() const noexcept { return data()[0]; }
+  constexpr reference back() noexcept { return data()[size() - 1]; }
+  constexpr const_reference back() const noexcept {
+    return data()[size() - 1];
+  }
+  constexpr iterator data() noexcept { return storage.data(); }
+  constexpr const_iterator data() const noexcept { return storage.data(); }
+
+  // static_vector iterators
+  constexpr iterator begin() noexcept { return data(); }
+  constexpr const_iterator begin() const noexcept { return data(); }
+  constexpr iterator end() noexcept { return data() + size(); }
+  constexpr const_iterator end() const noexcept { return data() + size(); }
+
+  // static_vector capacity
+  constexpr bool empty() const noexcept { return size() == 0; }
+  constexpr size_type size() const noexcept { return storage.count; }
+  constexpr size_type max_size() const noexcept { return N; }
+  constexpr void reserve(size_type size) { check_capacity(size); }
+  constexpr size_type capacity() const noexcept { return N; }
+  constexpr void shrink_to_fit() noexcept {}
+
+  // static_vector modifiers
+  constexpr void clear() noexcept {
+    if constexpr (!kTrivial) {
+      alloc_type alloc;
+      memory::destroy(alloc, begin(), end());
+    }
+    storage.count = 0;
+  }
+  iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  iterator insert(iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    alloc_type alloc;
+    iterator slot = begin() + (pos - begin());
+    iterator finish = end();
+    memory::emplace_shift(alloc, slot, finish, std::forward<Args>(args)...);
+    storage.count = finish - begin();
+    return slot;
+  }
+  void erase(iterator pos) noexcept {
+    alloc_type alloc;
+    memory::erase_shift(alloc, pos, end());
+    --storage.count;
+  }
+  constexpr void push_back(const_reference value) noexcept(
+      std::is_nothrow_copy_constructible<value_type>::value) {
+    emplace_back(value);
+  }
+  constexpr void push_back(value_type &&value) noexcept(
+      std::is_nothrow_move_constructible<value_type>::value) {
+    emplace_back(std::move(value));
+  }
+  template <typename... Args>
+  constexpr reference emplace_back(Args &&...args) noexcept(
+      std::is_nothrow_constructible<value_type, Args...>::value) {
+    if constexpr (kTrivial) {
+      storage.slots[size()] = value_type(std::forward<Args>(args)...);
+    } else {
+      alloc_type alloc;
+      alloc_traits::construct(alloc, end(), std::forward<Args>(args)...);
+    }
+    return data()[storage.count++];
+  }
+  // push_back that leaves a full vector untouched and returns false
+  constexpr bool try_push_back(const_reference value) noexcept(
+      std::is_nothrow_copy_constructible<value_type>::value) {
+    if (size() == N) return false;
+    emplace_back(value);
+    return true;
+  }
+  constexpr bool try_push_back(value_type &&value) noexcept(
+      std::is_nothrow_move_constructible<value_type>::value) {
+    if (size() == N) return false;
+    emplace_back(std::move(value));
+    return true;
+  }
+  constexpr void pop_back() noexcept {
+    if (!empty()) {
+      --storage.count;
+      if constexpr (!kTrivial) {
+        alloc_type alloc;
+        alloc_traits::destroy(alloc, end());
+      }
+    }
+  }
+  // swaps the common prefix element-wise and moves the longer tail over
+  void swap(static_vector &other) noexcept(
+      std::is_nothrow_swappable<value_type>::value &&
+      std::is_nothrow_move_constructible<value_type>::value) {
+    static_vector &shorter = size() < other.size() ? *this : other;
+    static_vector &longer = size() < other.size() ? other : *this;
+    size_type common = shorter.size();
+    for (size_type i = 0; i < common; ++i) {
+      using std::swap;
+      swap(data()[i], other.data()[i]);
+    }
+    alloc_type alloc;
+    memory::relocate(alloc, longer.data() + common, longer.size() - common,
+                     shorter.data() + common);
+    std::swap(storage.count, other.storage.count);
+  }
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    alloc_type alloc;
+    iterator slot = begin() + (pos - begin());
+    memory::pending_values<alloc_type, value_type, sizeof...(Args)> values(
+        alloc, std::forward<Args>(args)...);
+    iterator finish = end();
+    values.insert_at(slot, finish);
+    storage.count = finish - begin();
+    return slot;
+  }
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    insert_many(end(), std::forward<Args>(args)...);
+  }
+
+ private:
+  // the shared memory:: helpers construct through an allocator; the
+  // default one only ever placement-news into the inline storage here
+  using alloc_type = std::allocator<T>;
+  using alloc_traits = std::allocator_traits<alloc_type>;
+  static constexpr bool kTrivial = std::is_trivial<T>::value;
+
+  static constexpr void check_capacity(size_type size) {
+    if (size > N) throw std::length_error("static_vector capacity exceeded");
+  }
+  // moves the elements of v over and leaves it empty
+  constexpr void take(static_vector &v) {
+    if constexpr (kTrivial) {
+      for (size_type i = 0; i < v.size(); ++i) {
+        storage.slots[i] = v.storage.slots[i];
+      }
+    } else {
+      alloc_type alloc;
+      memory::relocate(alloc, v.data(), v.size(), data());
+    }
+    storage.count = v.storage.count;
+    v.storage.count = 0;
+  }
+
+  memory::static_storage<T, N> storage;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_STATIC_VECTOR_STATIC_VECTOR_H_
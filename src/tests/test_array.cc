@@ -50,24 +50,24 @@ TEST(array_constructor, case3) {
 }
 
 TEST(array_constructor, case4) {
-  s21::array<int, 3> s21_arr_int{1, 4, 8, 9};
-  s21::array<double, 3> s21_arr_double{1.4, 4.8, 8.9, 9.1};
-  s21::array<std::string, 3> s21_arr_string{"Hello", ",", "world", "!"};
+  s21::array<int, 3> s21_arr_int{1, 4};
+  s21::array<double, 3> s21_arr_double{1.4};
+  s21::array<std::string, 3> s21_arr_string{"Hello", ","};
 
   EXPECT_EQ(s21_arr_int.size(), 3U);
   EXPECT_EQ(s21_arr_int[0], 1);
   EXPECT_EQ(s21_arr_int[1], 4);
-  EXPECT_EQ(s21_arr_int[2], 8);
+  EXPECT_EQ(s21_arr_int[2], 0);
 
   EXPECT_EQ(s21_arr_double.size(), 3U);
   EXPECT_EQ(s21_arr_double[0], 1.4);
-  EXPECT_EQ(s21_arr_double[1], 4.8);
-  EXPECT_EQ(s21_arr_double[2], 8.9);
+  EXPECT_EQ(s21_arr_double[1], 0.0);
+  EXPECT_EQ(s21_arr_double[2], 0.0);
 
   EXPECT_EQ(s21_arr_string.size(), 3U);
   EXPECT_EQ(s21_arr_string[0], "Hello");
   EXPECT_EQ(s21_arr_string[1], ",");
-  EXPECT_EQ(s21_arr_string[2], "world");
+  EXPECT_EQ(s21_arr_string[2], "");
 }
 
 TEST(array_constructor, case5) {
@@ -107,21 +107,21 @@ TEST(array_constructor, case6) {
   s21::array<std::string, 4> s21_vec_ref_string{"Hello", ",", "world", "!"};
   s21::array<std::string, 4> s21_vec_res_string = std::move(s21_vec_ref_string);
 
-  EXPECT_EQ(s21_vec_ref_int.size(), 0U);
+  EXPECT_EQ(s21_vec_ref_int.size(), 4U);
   EXPECT_EQ(s21_vec_res_int.size(), 4U);
   EXPECT_EQ(s21_vec_res_int[0], 1);
   EXPECT_EQ(s21_vec_res_int[1], 4);
   EXPECT_EQ(s21_vec_res_int[2], 8);
   EXPECT_EQ(s21_vec_res_int[3], 9);
 
-  EXPECT_EQ(s21_vec_ref_double.size(), 0U);
+  EXPECT_EQ(s21_vec_ref_double.size(), 4U);
   EXPECT_EQ(s21_vec_res_double.size(), 4U);
   EXPECT_EQ(s21_vec_res_double[0], 1.4);
   EXPECT_EQ(s21_vec_res_double[1], 4.8);
   EXPECT_EQ(s21_vec_res_double[2], 8.9);
   EXPECT_EQ(s21_vec_res_double[3], 9.1);
 
-  EXPECT_EQ(s21_vec_ref_string.size(), 0U);
+  EXPECT_EQ(s21_vec_ref_string.size(), 4U);
   EXPECT_EQ(s21_vec_res_string.size(), 4U);
   EXPECT_EQ(s21_vec_res_string[0], "Hello");
   EXPECT_EQ(s21_vec_res_string[1], ",");
@@ -174,21 +174,21 @@ TEST(array_constructor, case8) {
   s21::array<std::string, 4> s21_vec_res_string;
   s21_vec_res_string = std::move(s21_vec_ref_string);
 
-  EXPECT_EQ(s21_vec_ref_int.size(), 0U);
+  EXPECT_EQ(s21_vec_ref_int.size(), 4U);
   EXPECT_EQ(s21_vec_res_int.size(), 4U);
   EXPECT_EQ(s21_vec_res_int[0], 1);
   EXPECT_EQ(s21_vec_res_int[1], 4);
   EXPECT_EQ(s21_vec_res_int[2], 8);
   EXPECT_EQ(s21_vec_res_int[3], 9);
 
-  EXPECT_EQ(s21_vec_ref_double.size(), 0U);
+  EXPECT_EQ(s21_vec_ref_double.size(), 4U);
   EXPECT_EQ(s21_vec_res_double.size(), 4U);
   EXPECT_EQ(s21_vec_res_double[0], 1.4);
   EXPECT_EQ(s21_vec_res_double[1], 4.8);
   EXPECT_EQ(s21_vec_res_double[2], 8.9);
   EXPECT_EQ(s21_vec_res_double[3], 9.1);
 
-  EXPECT_EQ(s21_vec_ref_string.size(), 0U);
+  EXPECT_EQ(s21_vec_ref_string.size(), 4U);
   EXPECT_EQ(s21_vec_res_string.size(), 4U);
   EXPECT_EQ(s21_vec_res_string[0], "Hello");
   EXPECT_EQ(s21_vec_res_string[1], ",");
@@ -377,3 +377,20 @@ TEST(array_fill, case1) {
     EXPECT_EQ(it, "asdf");
   }
 }
+
+TEST(array_inline, constexpr_aggregate) {
+  constexpr s21::array<int, 4> s21_arr_int{1, 4, 8, 9};
+  static_assert(s21_arr_int[2] == 8);
+  static_assert(s21_arr_int.back() == 9);
+  static_assert(s21_arr_int.size() == 4);
+  static_assert(std::is_aggregate<s21::array<float, 4>>::value);
+  static_assert(sizeof(s21::array<float, 4>) == 4 * sizeof(float));
+  static_assert(std::is_trivially_copyable<s21::array<float, 4>>::value);
+
+  s21::array<std::string, 2> s21_arr_string{"Hello", "world"};
+  s21::array<std::string, 2> s21_arr_moved = std::move(s21_arr_string);
+  EXPECT_EQ(s21_arr_moved[1], "world");
+  const s21::array<std::string, 2> &s21_arr_const = s21_arr_moved;
+  EXPECT_EQ(s21_arr_const.at(0), "Hello");
+  EXPECT_EQ(*(s21_arr_const.end() - 1), "world");
+}
@@ -0,0 +1,124 @@
+#include "test_main.h"
+
+TEST(btree_map_constructor, init_list_copy_move) {
+  s21::btree_map<int, std::string> s21_map{{2, "two"}, {1, "one"}};
+  s21::btree_map<int, std::string> s21_copy(s21_map);
+  s21::btree_map<int, std::string> s21_moved(std::move(s21_map));
+
+  EXPECT_EQ(s21_copy.size(), 2U);
+  EXPECT_EQ(s21_copy.at(1), "one");
+  EXPECT_EQ((*s21_copy.begin()).second, "one");
+  EXPECT_EQ(s21_moved.at(2), "two");
+  EXPECT_TRUE(s21_map.empty());
+  EXPECT_THROW(s21_copy.at(3), std::out_of_range);
+}
+
+// 64-byte nodes hold four entries, so splits, borrows and merges happen
+// on every level
+TEST(btree_map_modifiers, insert_erase_like_std) {
+  s21::btree_map<int, int, std::less<int>, 64> s21_map;
+  std::map<int, int> std_map;
+  unsigned seed = 11;
+  for (int i = 0; i < 40000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 3000);
+    if (seed & 0x10000) {
+      bool inserted = s21_map.insert(key, i).second;
+      EXPECT_EQ(inserted, std_map.insert({key, i}).second);
+    } else if (seed & 0x20000) {
+      auto it = s21_map.find(key);
+      EXPECT_EQ(it != s21_map.end(), std_map.count(key) == 1);
+      if (it != s21_map.end()) s21_map.erase(it);
+      std_map.erase(key);
+    } else {
+      s21_map.erase(key);
+      std_map.erase(key);
+    }
+  }
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  auto std_it = std_map.begin();
+  for (auto it = s21_map.begin(); it != s21_map.end(); ++it, ++std_it) {
+    EXPECT_EQ((*it).first, std_it->first);
+    EXPECT_EQ((*it).second, std_it->second);
+  }
+  auto s21_it = s21_map.end();
+  for (auto it = std_map.rbegin(); it != std_map.rend(); ++it) {
+    EXPECT_EQ((*--s21_it).first, it->first);
+  }
+  for (int key = -1; key <= 3000; key += 7) {
+    auto lower = s21_map.lower_bound(key);
+    auto upper = s21_map.upper_bound(key);
+    if (std_map.lower_bound(key) == std_map.end()) {
+      EXPECT_TRUE(lower == s21_map.end());
+    } else {
+      EXPECT_EQ((*lower).first, std_map.lower_bound(key)->first);
+    }
+    if (std_map.upper_bound(key) != std_map.end()) {
+      EXPECT_EQ((*upper).first, std_map.upper_bound(key)->first);
+    }
+  }
+
+  while (!s21_map.empty()) s21_map.erase(s21_map.begin());
+  EXPECT_TRUE(s21_map.begin() == s21_map.end());
+  s21_map[5] = 50;
+  EXPECT_EQ(s21_map.at(5), 50);
+}
+
+TEST(btree_map_modifiers, emplace_merge_and_copy) {
+  s21::btree_map<std::string, int> s21_map;
+  for (int i = 0; i < 500; ++i) s21_map.emplace(std::to_string(i), i);
+  EXPECT_FALSE(s21_map.try_emplace("7", 70).second);
+  EXPECT_EQ(s21_map["7"], 7);
+  s21_map.insert_or_assign("7", 70);
+  EXPECT_EQ(s21_map.at("7"), 70);
+
+  s21::btree_map<std::string, int> other{{"7", 0}, {"x", 1}, {"y", 2}};
+  s21_map.merge(other);
+  EXPECT_EQ(s21_map.size(), 502U);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at("7"), 0);
+
+  s21::btree_map<std::string, int> copy;
+  copy = s21_map;
+  s21_map.clear();
+  EXPECT_EQ(copy.size(), 502U);
+  EXPECT_EQ(copy.at("499"), 499);
+  std::string prev;
+  for (auto it = copy.begin(); it != copy.end(); ++it) {
+    EXPECT_LT(prev, (*it).first);
+    prev = (*it).first;
+  }
+}
+
+TEST(btree_map_modifiers, hint_and_range) {
+  std::map<int, int> std_map;
+  for (int i = 0; i < 2000; ++i) std_map.emplace(i * 2, i);
+  s21::btree_map<int, int, std::less<int>, 64> s21_map(std_map.begin(),
+                                                        std_map.end());
+  ASSERT_EQ(s21_map.size(), std_map.size());
+
+  // good hints, hints off by a lot, and keys that are already there
+  for (int i = 0; i < 3000; ++i) {
+    int key = (i * 7919) % 6007;
+    auto hint = i % 3 == 0 ? s21_map.end() : s21_map.lower_bound(key);
+    if (i % 5 == 0) hint = s21_map.begin();
+    auto it = i % 2 == 0 ? s21_map.insert(hint, {key, -i})
+                         : s21_map.emplace_hint(hint, key, -i);
+    auto std_it = std_map.emplace(key, -i).first;
+    EXPECT_EQ((*it).first, key);
+    EXPECT_EQ((*it).second, std_it->second);
+  }
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  auto std_it = std_map.begin();
+  for (auto it = s21_map.begin(); it != s21_map.end(); ++it, ++std_it) {
+    EXPECT_EQ((*it).first, std_it->first);
+    EXPECT_EQ((*it).second, std_it->second);
+  }
+  for (int key = 0; key < 6007; ++key) {
+    EXPECT_EQ(s21_map.contains(key), std_map.count(key) == 1);
+  }
+
+  s21_map.assign_sorted(std_map.rbegin(), std_map.rend());
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  EXPECT_EQ((*s21_map.begin()).first, std_map.begin()->first);
+}
@@ -0,0 +1,150 @@
+#include "test_main.h"
+
+namespace {
+// int key whose copies throw while armed; moves never do
+struct ThrowingCopyKey {
+  static inline bool armed = false;
+  int value = 0;
+  ThrowingCopyKey(int v = 0) : value(v) {}
+  ThrowingCopyKey(const ThrowingCopyKey &other) : value(other.value) {
+    if (armed) throw std::runtime_error("copy");
+  }
+  ThrowingCopyKey(ThrowingCopyKey &&other) noexcept = default;
+  ThrowingCopyKey &operator=(const ThrowingCopyKey &other) {
+    if (armed) throw std::runtime_error("copy");
+    value = other.value;
+    return *this;
+  }
+  ThrowingCopyKey &operator=(ThrowingCopyKey &&other) noexcept = default;
+  bool operator<(const ThrowingCopyKey &other) const {
+    return value < other.value;
+  }
+};
+}  // namespace
+
+TEST(btree_set_modifiers, insert_erase_like_std) {
+  s21::btree_set<int, std::less<int>, 64> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 5000; ++i) {
+    int key = (i * 7919) % 2003;
+    EXPECT_EQ(s21_set.insert(key).second, std_set.insert(key).second);
+  }
+  for (int key = 0; key < 2003; key += 3) {
+    s21_set.erase(key);
+    std_set.erase(key);
+  }
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_set.begin()));
+  EXPECT_FALSE(s21_set.contains(3));
+  EXPECT_TRUE(s21_set.contains(4));
+  EXPECT_EQ(*s21_set.lower_bound(3), 4);
+  EXPECT_EQ(*s21_set.upper_bound(4), 5);
+}
+
+TEST(btree_set_modifiers, merge_and_swap) {
+  s21::btree_set<int> s21_set{1, 2, 3};
+  s21::btree_set<int> other{3, 4};
+  s21_set.merge(other);
+  EXPECT_EQ(s21_set.size(), 4U);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_TRUE(other.contains(3));
+
+  s21_set.swap(other);
+  EXPECT_EQ(s21_set.size(), 1U);
+  EXPECT_EQ(*(--other.end()), 4);
+}
+
+TEST(btree_multiset_modifiers, equal_keys_like_std) {
+  s21::btree_multiset<int, std::less<int>, 64> s21_set;
+  std::multiset<int> std_set;
+  for (int i = 0; i < 3000; ++i) {
+    s21_set.insert(i % 37);
+    std_set.insert(i % 37);
+  }
+  for (int key = 0; key < 37; key += 2) {
+    for (int i = 0; i < 40; ++i) {
+      s21_set.erase(key);
+      std_set.erase(std_set.find(key));
+    }
+  }
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_set.begin()));
+  for (int key = 0; key < 37; ++key) {
+    EXPECT_EQ(s21_set.count(key), std_set.count(key));
+  }
+
+  s21::btree_multiset<int, std::less<int>, 64> other{5, 5, 100};
+  s21_set.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(s21_set.count(5), std_set.count(5) + 2);
+  EXPECT_EQ(*(--s21_set.end()), 100);
+}
+
+TEST(btree_set_modifiers, hint_and_range) {
+  std::vector<int> keys;
+  for (int i = 0; i < 3000; ++i) keys.push_back((i * 7919) % 1009);
+  std::set<int> std_set(keys.begin(), keys.end());
+  s21::btree_set<int, std::less<int>, 64> s21_set(keys.begin(), keys.end());
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_set.begin()));
+
+  s21_set.clear();
+  for (int i = 0; i < 3000; ++i) {
+    auto hint = i % 2 == 0 ? s21_set.end() : s21_set.upper_bound(keys[i]);
+    EXPECT_EQ(*s21_set.emplace_hint(hint, keys[i]), keys[i]);
+  }
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_set.begin()));
+}
+
+TEST(btree_multiset_modifiers, hint_and_range) {
+  std::vector<int> keys;
+  for (int i = 0; i < 3000; ++i) keys.push_back(i % 37);
+  std::multiset<int> std_set(keys.begin(), keys.end());
+  s21::btree_multiset<int, std::less<int>, 64> s21_set;
+  s21_set.assign_sorted(std_set.begin(), std_set.end());
+  ASSERT_EQ(s21_set.size(), std_set.size());
+
+  for (int i = 0; i < 3000; ++i) {
+    auto hint = i % 3 == 0 ? s21_set.begin() : s21_set.lower_bound(keys[i]);
+    EXPECT_EQ(*s21_set.insert(hint, keys[i]), keys[i]);
+    std_set.insert(keys[i]);
+  }
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_set.begin()));
+  for (int key = 0; key < 37; ++key) {
+    EXPECT_EQ(s21_set.count(key), std_set.count(key));
+  }
+}
+
+TEST(btree_set_modifiers, erase_with_throwing_key_copy) {
+  s21::btree_set<ThrowingCopyKey, std::less<ThrowingCopyKey>, 64> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 2000; ++i) {
+    s21_set.insert(ThrowingCopyKey(i));
+    std_set.insert(i);
+  }
+  ThrowingCopyKey::armed = true;
+  int thrown = 0;
+  for (int i = 0; i < 2000; i += 3) {
+    try {
+      s21_set.erase(s21_set.find(ThrowingCopyKey(i)));
+    } catch (const std::runtime_error &) {
+      ++thrown;
+    }
+    std_set.erase(i);
+  }
+  ThrowingCopyKey::armed = false;
+  EXPECT_GT(thrown, 0);
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  auto std_it = std_set.begin();
+  for (auto it = s21_set.begin(); it != s21_set.end(); ++it, ++std_it) {
+    EXPECT_EQ((*it).value, *std_it);
+  }
+  for (int i = 0; i < 2000; ++i) {
+    EXPECT_EQ(s21_set.contains(ThrowingCopyKey(i)), std_set.count(i) == 1);
+  }
+  // the tree still rebalances once copies work again
+  for (int i = 1; i < 2000; i += 3) s21_set.erase(ThrowingCopyKey(i));
+  EXPECT_EQ(s21_set.size(), std_set.size() - 667);
+}
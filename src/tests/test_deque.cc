@@ -0,0 +1,127 @@
+#include "test_main.h"
+
+namespace {
+template <typename T>
+void ExpectEqual(const s21::deque<T> &s21_deq, const std::deque<T> &std_deq) {
+  ASSERT_EQ(s21_deq.size(), std_deq.size());
+  EXPECT_TRUE(std::equal(s21_deq.begin(), s21_deq.end(), std_deq.begin()));
+}
+}  // namespace
+
+TEST(deque_constructor, case1) {
+  s21::deque<int> s21_deq;
+  s21::deque<std::string> s21_deq_string(3);
+  s21::deque<int> s21_deq_list{1, 2, 3};
+
+  EXPECT_TRUE(s21_deq.empty());
+  EXPECT_EQ(s21_deq.capacity(), 0U);
+  EXPECT_EQ(s21_deq.begin(), s21_deq.end());
+  EXPECT_EQ(s21_deq_string.size(), 3U);
+  EXPECT_EQ(s21_deq_string[2], "");
+  EXPECT_EQ(s21_deq_list.front(), 1);
+  EXPECT_EQ(s21_deq_list.back(), 3);
+  EXPECT_THROW(s21_deq_list.at(3), std::out_of_range);
+}
+
+TEST(deque_constructor, copy_and_move) {
+  s21::deque<std::string> s21_deq{"b", "c"};
+  s21_deq.push_front("a");
+  auto copy = s21_deq;
+  auto moved = std::move(s21_deq);
+  EXPECT_TRUE(s21_deq.empty());
+  ExpectEqual(copy, {"a", "b", "c"});
+  ExpectEqual(moved, {"a", "b", "c"});
+
+  copy.pop_front();
+  moved = copy;
+  ExpectEqual(moved, {"b", "c"});
+  s21_deq = std::move(copy);
+  ExpectEqual(s21_deq, {"b", "c"});
+  EXPECT_TRUE(copy.empty());
+}
+
+TEST(deque_modifiers, both_ends) {
+  s21::deque<std::string> s21_deq;
+  std::deque<std::string> std_deq;
+  for (int i = 0; i < 200; ++i) {
+    std::string value = std::to_string(i);
+    if (i % 2 == 0) {
+      s21_deq.push_back(value);
+      std_deq.push_back(value);
+    } else {
+      s21_deq.push_front(value);
+      std_deq.push_front(value);
+    }
+    if (i % 7 == 3) {
+      s21_deq.pop_back();
+      std_deq.pop_back();
+    }
+    if (i % 5 == 4) {
+      s21_deq.pop_front();
+      std_deq.pop_front();
+    }
+  }
+  ExpectEqual(s21_deq, std_deq);
+  EXPECT_EQ(s21_deq.at(10), std_deq.at(10));
+  EXPECT_EQ(s21_deq.end() - s21_deq.begin(),
+            static_cast<std::ptrdiff_t>(std_deq.size()));
+
+  s21_deq.shrink_to_fit();
+  EXPECT_EQ(s21_deq.capacity(), 256U);
+  ExpectEqual(s21_deq, std_deq);
+  s21_deq.clear();
+  s21_deq.shrink_to_fit();
+  EXPECT_EQ(s21_deq.capacity(), 0U);
+}
+
+TEST(deque_capacity, reserve_too_big) {
+  s21::deque<int> s21_deq{1, 2};
+  EXPECT_THROW(s21_deq.reserve((size_t(1) << 63) | 1), std::length_error);
+  EXPECT_THROW(s21_deq.reserve(s21_deq.max_size() + 1), std::length_error);
+  EXPECT_EQ(s21_deq.size(), 2U);
+  EXPECT_EQ(s21_deq.back(), 2);
+}
+
+TEST(deque_modifiers, self_reference) {
+  s21::deque<std::string> s21_deq{"Hello"};
+  for (int i = 0; i < 5; ++i) {
+    s21_deq.push_back(s21_deq.front());
+    s21_deq.push_front(s21_deq.back());
+  }
+  s21_deq.insert_many_back(s21_deq[0], s21_deq[1]);
+  s21_deq.insert_many_front("x", "y");
+  EXPECT_EQ(s21_deq.size(), 15U);
+  EXPECT_EQ(s21_deq[0], "y");
+  EXPECT_EQ(s21_deq[1], "x");
+  for (auto it = s21_deq.begin() + 2; it != s21_deq.end(); ++it) {
+    EXPECT_EQ(*it, "Hello");
+  }
+}
+
+TEST(deque_modifiers, swap) {
+  s21::deque<int> first{1, 2, 3};
+  s21::deque<int> second{4};
+  first.swap(second);
+  ExpectEqual(first, {4});
+  ExpectEqual(second, {1, 2, 3});
+}
+
+TEST(deque_allocator, grows_by_doubling) {
+  using counted = s21_test::CountingAllocator<int>;
+  counted::allocations = 0;
+  s21::deque<int, counted> s21_deq;
+  for (int i = 0; i < 1024; ++i) {
+    s21_deq.push_back(i);
+    s21_deq.pop_front();
+    s21_deq.push_back(i);
+  }
+  EXPECT_EQ(s21_deq.size(), 1024U);
+  EXPECT_EQ(counted::allocations, 8);
+
+  for (int i = 0; i < 100000; ++i) {
+    s21_deq.pop_front();
+    s21_deq.push_back(i);
+  }
+  EXPECT_EQ(counted::allocations, 8);
+  EXPECT_EQ(s21_deq.back(), 99999);
+}
@@ -0,0 +1,71 @@
+#include "test_main.h"
+
+TEST(flat_map_constructor, init_list_copy_move) {
+  s21::flat_map<int, std::string> s21_map{{2, "two"}, {1, "one"}, {2, "x"}};
+  s21::flat_map<int, std::string> s21_copy(s21_map);
+  s21::flat_map<int, std::string> s21_moved(std::move(s21_map));
+
+  EXPECT_EQ(s21_copy.size(), 2U);
+  EXPECT_EQ(s21_copy.at(2), "two");
+  EXPECT_EQ((*s21_copy.begin()).second, "one");
+  EXPECT_EQ(s21_moved.at(1), "one");
+  EXPECT_TRUE(s21_map.empty());
+  EXPECT_THROW(s21_copy.at(3), std::out_of_range);
+}
+
+TEST(flat_map_modifiers, insert_erase_like_std) {
+  s21::flat_map<int, int> s21_map;
+  std::map<int, int> std_map;
+  unsigned seed = 3;
+  for (int i = 0; i < 5000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>((seed >> 8) % 1000);
+    if (seed & 0x10000) {
+      bool inserted = s21_map.insert(key, i).second;
+      EXPECT_EQ(inserted, std_map.insert({key, i}).second);
+    } else {
+      s21_map.erase(key);
+      std_map.erase(key);
+    }
+  }
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  auto std_it = std_map.begin();
+  for (auto it = s21_map.begin(); it != s21_map.end(); ++it, ++std_it) {
+    EXPECT_EQ((*it).first, std_it->first);
+    EXPECT_EQ((*it).second, std_it->second);
+  }
+  for (int key = -1; key <= 1000; ++key) {
+    EXPECT_EQ(s21_map.contains(key), std_map.count(key) == 1);
+    auto lower = std_map.lower_bound(key);
+    if (lower != std_map.end()) {
+      EXPECT_EQ((*s21_map.lower_bound(key)).first, lower->first);
+    }
+    auto upper = std_map.upper_bound(key);
+    if (upper != std_map.end()) {
+      EXPECT_EQ((*s21_map.upper_bound(key)).first, upper->first);
+    }
+  }
+}
+
+TEST(flat_map_modifiers, bulk_insert_merges) {
+  s21::flat_map<int, int> s21_map{{10, 0}, {20, 0}, {30, 0}};
+  std::vector<std::pair<int, int>> batch{{25, 1}, {5, 1}, {20, 1}, {5, 2}};
+  s21_map.insert(batch.begin(), batch.end());
+
+  std::vector<int> keys(s21_map.keys().begin(), s21_map.keys().end());
+  EXPECT_EQ(keys, (std::vector<int>{5, 10, 20, 25, 30}));
+  EXPECT_EQ(s21_map.at(5), 1);
+  EXPECT_EQ(s21_map.at(20), 0);
+
+  s21::flat_map<int, int> other{{5, 9}, {40, 9}};
+  s21_map.merge(other);
+  EXPECT_EQ(s21_map.size(), 6U);
+  EXPECT_EQ(s21_map.at(40), 9);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at(5), 9);
+
+  s21_map.insert_or_assign(5, 7);
+  s21_map[50] = 8;
+  EXPECT_EQ(s21_map.at(5), 7);
+  EXPECT_EQ((*--s21_map.end()).second, 8);
+}
@@ -0,0 +1,39 @@
+#include "test_main.h"
+
+TEST(flat_set_modifiers, insert_erase_like_std) {
+  s21::flat_set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 3000; ++i) {
+    int key = (i * 7919) % 1009;
+    EXPECT_EQ(s21_set.insert(key).second, std_set.insert(key).second);
+  }
+  for (int key = 0; key < 1009; key += 3) {
+    s21_set.erase(key);
+    std_set.erase(key);
+  }
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_set.begin()));
+  EXPECT_FALSE(s21_set.contains(3));
+  EXPECT_EQ(*s21_set.lower_bound(3), 4);
+  EXPECT_EQ(*s21_set.upper_bound(4), 5);
+  EXPECT_TRUE(s21_set.upper_bound(1008) == s21_set.end());
+}
+
+TEST(flat_set_modifiers, bulk_insert_and_merge) {
+  std::vector<std::string> words{"pear", "apple", "fig", "apple", "kiwi"};
+  s21::flat_set<std::string> s21_set(words.begin(), words.end());
+  EXPECT_EQ(s21_set.size(), 4U);
+  EXPECT_EQ(*s21_set.begin(), "apple");
+
+  std::vector<std::string> more{"lime", "fig", "banana"};
+  s21_set.insert(more.begin(), more.end());
+  std::set<std::string> std_set(words.begin(), words.end());
+  std_set.insert(more.begin(), more.end());
+  EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_set.begin()));
+
+  s21::flat_set<std::string> other{"fig", "plum"};
+  s21_set.merge(other);
+  EXPECT_TRUE(s21_set.contains("plum"));
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_TRUE(other.contains("fig"));
+}
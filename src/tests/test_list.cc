@@ -220,6 +220,54 @@ TEST(List, Sort) {
   EXPECT_EQ(list.size(), list_std.size());
 }
 
+TEST(List, Sort_Empty_And_Large) {
+  s21::list<int> empty;
+  empty.sort();
+  EXPECT_TRUE(empty.empty());
+
+  s21::list<int> list;
+  std::list<int> list_std;
+  unsigned seed = 12345;
+  for (int i = 0; i < 10000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    list.push_back(seed % 1000);
+    list_std.push_back(seed % 1000);
+  }
+  int *first = &*list.begin();
+  list.sort();
+  list_std.sort();
+  ASSERT_EQ(list.size(), list_std.size());
+  auto it_std = list_std.begin();
+  for (auto it = list.begin(); it != list.end(); ++it, ++it_std) {
+    EXPECT_EQ(*it, *it_std);
+  }
+  EXPECT_EQ(list.back(), list_std.back());
+  bool node_kept = false;
+  for (auto it = list.begin(); it != list.end(); ++it) {
+    node_kept = node_kept || &*it == first;
+  }
+  EXPECT_TRUE(node_kept);
+}
+
+TEST(List, Sort_Comparator_Stable) {
+  s21::list<std::pair<int, int>> list;
+  for (int i = 0; i < 100; ++i) {
+    list.emplace_back(i % 7, i);
+  }
+  list.sort([](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+    return a.first > b.first;
+  });
+  auto it = list.begin();
+  std::pair<int, int> prev = *it;
+  for (++it; it != list.end(); ++it) {
+    EXPECT_TRUE(prev.first > (*it).first ||
+                (prev.first == (*it).first && prev.second < (*it).second));
+    prev = *it;
+  }
+  EXPECT_EQ(list.front().first, 6);
+  EXPECT_EQ(list.back(), std::make_pair(0, 98));
+}
+
 TEST(List, Merge) {
   s21::list<int> list = {1, 2, 3, 4};
   s21::list<int> list_m = {2, 5, 4, 3};
@@ -339,6 +387,58 @@ TEST(List, Splice) {
   EXPECT_EQ(list.size(), list_std.size());
 }
 
+TEST(List, Splice_Element_And_Range) {
+  s21::list<int> list = {1, 5};
+  s21::list<int> other = {2, 3, 4, 6};
+  int *three = &*(other.begin() + 1);
+  list.splice(list.begin() + 1, other, other.begin() + 1);
+  list.splice(list.begin() + 1, other, other.begin());
+  list.splice(list.begin() + 3, other, other.begin(), other.begin() + 1);
+  list.splice(list.end(), other, other.begin(), other.end());
+  std::list<int> expected = {1, 2, 3, 4, 5, 6};
+  ASSERT_EQ(list.size(), expected.size());
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(other.size(), 0U);
+  auto it_std = expected.begin();
+  for (auto it = list.begin(); it != list.end(); ++it, ++it_std) {
+    EXPECT_EQ(*it, *it_std);
+  }
+  EXPECT_EQ(&*(list.begin() + 2), three);
+  EXPECT_EQ(*--list.end(), 6);
+
+  list.splice(list.begin(), list, list.begin() + 4, list.end());
+  EXPECT_EQ(list.size(), 6U);
+  EXPECT_EQ(list.front(), 5);
+  EXPECT_EQ(list.back(), 4);
+}
+
+TEST(List, Merge_Relinks_Stable) {
+  using item = std::pair<int, char>;
+  auto by_key = [](const item &a, const item &b) { return a.first < b.first; };
+  s21::list<item> list;
+  s21::list<item> other;
+  list.emplace_back(1, 'a');
+  list.emplace_back(3, 'a');
+  other.emplace_back(1, 'b');
+  other.emplace_back(2, 'b');
+  other.emplace_back(4, 'b');
+  item *two = &*(other.begin() + 1);
+  list.merge(other, by_key);
+  EXPECT_TRUE(other.empty());
+  ASSERT_EQ(list.size(), 5U);
+  auto it = list.begin();
+  EXPECT_EQ(*it, item(1, 'a'));
+  EXPECT_EQ(*++it, item(1, 'b'));
+  EXPECT_EQ(&*++it, two);
+  EXPECT_EQ(*++it, item(3, 'a'));
+  EXPECT_EQ(list.back(), item(4, 'b'));
+
+  s21::list<item> empty;
+  empty.merge(list, by_key);
+  EXPECT_EQ(empty.size(), 5U);
+  EXPECT_TRUE(list.empty());
+}
+
 TEST(List, Iterator) {
   s21::list<int> lol = {1337, 228, 123, 69};
   s21::list<int>::const_iterator itr = lol.end();
@@ -359,6 +459,12 @@ TEST(List, Iterator) {
   EXPECT_EQ(*itr, 4);
 }
 
+TEST(List, Iterator_Empty) {
+  s21::list<int> list;
+  s21::list<int>::const_iterator const_it = list.begin();
+  EXPECT_EQ(*const_it, 0);
+}
+
 TEST(List, Insert_Many) {
   s21::list<int> list = {1, 5, 6};
   s21::list<int>::iterator it = list.begin();
@@ -413,4 +519,20 @@ TEST(List, Insert_Many_Front) {
   EXPECT_EQ(*it, 5);
   ++it;
   EXPECT_EQ(*it, 6);
-}
\ No newline at end of file
+}
+TEST(List, Emplace) {
+  s21::list<std::pair<int, std::string>> list;
+  list.emplace_back(2, "two");
+  list.emplace_front(1, "one");
+  auto it = list.emplace(list.end(), 3, "three");
+  EXPECT_EQ((*it).second, "three");
+  EXPECT_EQ(list.size(), 3U);
+  EXPECT_EQ(list.front().second, "one");
+  EXPECT_EQ(list.back().first, 3);
+
+  std::string moved(100, 'x');
+  s21::list<std::string> strings;
+  strings.push_back(std::move(moved));
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(strings.front().size(), 100U);
+}
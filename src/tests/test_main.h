@@ -8,8 +8,37 @@
 #include <queue>
 #include <set>
 #include <stack>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "../s21_containers.h"
 #include "../s21_containersplus.h"
+
+namespace s21_test {
+// std::allocator that counts, per element type, the blocks it has handed
+// out in allocations and the ones not given back yet in live
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  static inline int allocations = 0;
+  static inline int live = 0;
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+  T *allocate(size_t n) {
+    ++allocations;
+    ++live;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *p, size_t n) {
+    --live;
+    std::allocator<T>().deallocate(p, n);
+  }
+  bool operator==(const CountingAllocator &) const { return true; }
+  bool operator!=(const CountingAllocator &) const { return false; }
+};
+}  // namespace s21_test
+
 #endif  // S21_CONTAINERS_TEST_MAIN_H_
@@ -303,3 +303,207 @@ TEST_F(MapTest, caseContains) {
   EXPECT_EQ(double_double.contains(1.1), true);
   EXPECT_EQ(string_int.contains("5"), false);
 }
+
+TEST_F(MapTest, caseSharedPool) {
+  auto pool = std::make_shared<s21::map<int, std::string>::node_pool>();
+  s21::map<int, std::string> first(pool);
+  s21::map<int, std::string> second(pool);
+  for (int i = 0; i < 100; ++i) {
+    first.insert(i, std::to_string(i));
+    second.insert(-i, std::to_string(-i));
+  }
+  for (int i = 0; i < 100; i += 2) {
+    first.erase(i);
+  }
+  first.clear();
+  for (int i = 0; i < 50; ++i) {
+    first.insert(i, "reused");
+  }
+
+  EXPECT_EQ(first.size(), 50U);
+  EXPECT_EQ(first.at(49), "reused");
+  EXPECT_EQ(second.size(), 100U);
+  EXPECT_EQ(second.at(-99), "-99");
+  EXPECT_EQ((*second.begin()).first, -99);
+}
+
+TEST(map_emplace, try_emplace_keeps_arguments) {
+  s21::map<int, std::unique_ptr<int>> m;
+  auto value = std::make_unique<int>(1);
+  auto res = m.try_emplace(1, std::move(value));
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(value, nullptr);
+
+  value = std::make_unique<int>(2);
+  res = m.try_emplace(1, std::move(value));
+  EXPECT_FALSE(res.second);
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(*(*res.first).second, 1);
+
+  auto emplaced = m.emplace(2, std::make_unique<int>(3));
+  EXPECT_TRUE(emplaced.second);
+  EXPECT_EQ(*(*emplaced.first).second, 3);
+  EXPECT_EQ(*m[2], 3);
+  EXPECT_EQ(m[5], nullptr);
+  EXPECT_EQ(m.size(), 3U);
+}
+
+TEST(map_emplace, insert_many_moves) {
+  s21::map<std::string, std::string> m;
+  std::pair<std::string, std::string> a("a", std::string(64, 'a'));
+  auto res = m.insert_many(std::move(a),
+                           std::pair<std::string, std::string>("b", "b"));
+  EXPECT_TRUE(res[0].second);
+  EXPECT_TRUE(res[1].second);
+  EXPECT_TRUE(a.second.empty());
+  EXPECT_EQ(m.at("a").size(), 64U);
+}
+
+TEST(map_compare, greater_and_transparent) {
+  s21::map<int, int, std::greater<int>> desc{{1, 1}, {3, 3}, {2, 2}};
+  EXPECT_EQ((*desc.begin()).first, 3);
+  EXPECT_EQ((*(--desc.end())).first, 1);
+  EXPECT_EQ(sizeof(desc), sizeof(s21::map<int, int>));
+
+  s21::map<std::string, int, std::less<>> m{{"alpha", 1}, {"beta", 2}};
+  std::string_view key = "beta";
+  EXPECT_TRUE(m.contains(key));
+  EXPECT_EQ((*m.find(key)).second, 2);
+  EXPECT_TRUE(m.find(std::string_view("gamma")) == m.end());
+  EXPECT_TRUE(m.find("alpha") == m.begin());
+}
+
+TEST(map_constructor, sorted_range) {
+  std::vector<std::pair<int, std::string>> items;
+  for (int i = 0; i < 100; ++i) items.emplace_back(i, std::to_string(i));
+  s21::map<int, std::string> m(items.begin(), items.end());
+  EXPECT_EQ(m.size(), 100U);
+  EXPECT_EQ(m.at(42), "42");
+  EXPECT_EQ((*m.begin()).first, 0);
+
+  items.emplace_back(5, "dup");
+  m.assign_sorted(items.begin(), items.end());
+  EXPECT_EQ(m.size(), 100U);
+  EXPECT_EQ(m.at(5), "5");
+}
+
+TEST(map_modifiers, insert_with_hint) {
+  s21::map<int, std::string> m;
+  for (int i = 0; i < 100; ++i) {
+    m.emplace_hint(m.end(), i, std::to_string(i));
+  }
+  auto it = m.insert(m.begin(), std::pair<const int, std::string>(-1, "-1"));
+  EXPECT_EQ((*it).second, "-1");
+  it = m.insert(m.end(), std::pair<const int, std::string>(50, "dup"));
+  EXPECT_EQ((*it).first, 50);
+  EXPECT_EQ((*it).second, "50");
+  EXPECT_EQ(m.size(), 101U);
+  EXPECT_EQ((*m.begin()).first, -1);
+  EXPECT_EQ(m.at(99), "99");
+}
+
+TEST(map_modifiers, insert_or_assign_moves) {
+  s21::map<std::string, std::unique_ptr<int>> m;
+  auto res = m.insert_or_assign("a", std::make_unique<int>(1));
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*(*res.first).second, 1);
+
+  auto value = std::make_unique<int>(2);
+  res = m.insert_or_assign(std::string("a"), std::move(value));
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(value, nullptr);
+  EXPECT_EQ(*(*res.first).second, 2);
+  EXPECT_EQ(m.size(), 1U);
+
+  s21::map<int, int> counters;
+  for (int i = 0; i < 1000; ++i) counters[i % 7] += i;
+  EXPECT_EQ(counters.size(), 7U);
+  EXPECT_EQ(counters[0], 71071);
+}
+
+namespace {
+struct CountedKey {
+  static int copies;
+  int value;
+  CountedKey(int v = 0) : value(v) {}
+  CountedKey(const CountedKey &other) : value(other.value) { ++copies; }
+  bool operator<(const CountedKey &other) const { return value < other.value; }
+};
+int CountedKey::copies = 0;
+}  // namespace
+
+TEST(map_modifiers, assign_does_not_copy_key) {
+  s21::map<CountedKey, int> m;
+  CountedKey key(1);
+  m.insert_or_assign(key, 1);
+  CountedKey::copies = 0;
+  m.insert_or_assign(key, 2);
+  m.insert_or_assign(CountedKey(1), 3);
+  m.at(key) += 1;
+  EXPECT_EQ(CountedKey::copies, 0);
+  EXPECT_EQ(m.at(key), 4);
+}
+
+TEST(map_modifiers, extract_and_reinsert) {
+  s21::map<int, std::string> m{{1, "one"}, {2, "two"}, {3, "three"}};
+  auto *node = m.find(2).operator->();
+  auto handle = m.extract(2);
+  EXPECT_FALSE(handle.empty());
+  EXPECT_EQ(m.size(), 2U);
+  EXPECT_FALSE(m.contains(2));
+
+  handle.key() = 20;
+  auto res = m.insert(std::move(handle));
+  EXPECT_TRUE(res.inserted);
+  EXPECT_TRUE(res.node.empty());
+  EXPECT_EQ((*res.position).second, "two");
+  EXPECT_EQ(m.find(20).operator->(), node);
+
+  auto dup = m.extract(m.begin());
+  dup.key() = 3;
+  res = m.insert(std::move(dup));
+  EXPECT_FALSE(res.inserted);
+  EXPECT_EQ(res.node.mapped(), "one");
+  EXPECT_EQ((*res.position).second, "three");
+  EXPECT_TRUE(m.extract(42).empty());
+  EXPECT_TRUE(m.insert(m.extract(42)).position == m.end());
+}
+
+TEST(map_modifiers, merge_relinks_nodes) {
+  s21::map<int, std::string> m{{1, "a"}, {3, "c"}};
+  s21::map<int, std::string> other{{1, "x"}, {2, "b"}, {4, "d"}};
+  auto *node = other.find(4).operator->();
+  m.merge(other);
+  EXPECT_EQ(m.size(), 4U);
+  EXPECT_EQ(m.at(1), "a");
+  EXPECT_EQ(m.find(4).operator->(), node);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_EQ(other.at(1), "x");
+
+  // nodes stay valid in both maps after their pools were joined
+  other.clear();
+  m.insert(5, "e");
+  EXPECT_EQ(m.at(2), "b");
+  EXPECT_EQ(m.size(), 5U);
+}
+
+TEST(map_lookup, order_statistics) {
+  s21::map<int, int, std::less<int>, true> m;
+  for (int i = 0; i < 300; ++i) m.insert((i * 37) % 300, i);
+  for (int key = 0; key < 300; key += 2) m.erase(key);
+
+  EXPECT_EQ(m.size(), 150U);
+  EXPECT_EQ((*m.nth(0)).first, 1);
+  EXPECT_EQ((*m.nth(149)).first, 299);
+  EXPECT_EQ(m.rank(101), 50U);
+  EXPECT_EQ(m.rank(100), 50U);
+
+  s21::map<int, int, std::less<int>, true> copy(m);
+  auto it = copy.begin();
+  it += 75;
+  EXPECT_EQ((*it).first, 151);
+  it -= 25;
+  EXPECT_EQ((*it).first, 101);
+  EXPECT_EQ(it.index(), 50U);
+  EXPECT_TRUE(copy.nth(150) == copy.end());
+}
@@ -139,7 +139,8 @@ TEST(multiset_capacity, max_size) {
   s21::multiset<int> my_mset{1, 2, 3};
   std::multiset<int> std_set_int{1, 2, 3};
 
-  EXPECT_EQ(my_mset.max_size(), std_set_int.max_size());
+  // packed key-only nodes are smaller than the std ones
+  EXPECT_GE(my_mset.max_size(), std_set_int.max_size());
 }
 
 // ---------------- MODIFIERS ---------------- //
@@ -270,6 +271,22 @@ TEST(multiset_modifiers, merge) {
   }
 }
 
+TEST(multiset_modifiers, merge_and_extract) {
+  s21::multiset<int> a{1, 2, 2};
+  s21::multiset<int> b{2, 3};
+  a.merge(b);
+  EXPECT_EQ(a.size(), 5U);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.count(2), 3U);
+
+  auto handle = a.extract(2);
+  EXPECT_EQ(a.count(2), 2U);
+  handle.value() = 0;
+  auto it = a.insert(std::move(handle));
+  EXPECT_EQ(*it, 0);
+  EXPECT_TRUE(it == a.begin());
+}
+
 // insert_many
 TEST(multiset_modifiers, insert_many) {
   s21::multiset<int> my_mset1;
@@ -409,4 +426,146 @@ TEST(multiset_lookup, equal_range) {
   EXPECT_EQ(*(my_res.second), *(std_res.second));
 }
 
+TEST(multiset_lookup, equal_range1) {
+  s21::multiset<int> my_mset1;
+  my_mset1.insert_many(66, 23, 1, 1, 1, 0);
+
+  auto my_res = my_mset1.equal_range(5);
+
+  EXPECT_TRUE(my_res.first == my_res.second);
+  EXPECT_EQ(*(my_res.first), 23);
+}
+
+TEST(multiset_lookup, bounds_past_end) {
+  s21::multiset<int> my_mset1;
+  my_mset1.insert_many(66, 23, 1, 1, 1, 0);
+
+  EXPECT_TRUE(my_mset1.lower_bound(67) == my_mset1.end());
+  EXPECT_TRUE(my_mset1.upper_bound(66) == my_mset1.end());
+  EXPECT_TRUE(my_mset1.find(67) == my_mset1.end());
+  EXPECT_EQ(my_mset1.count(67), 0U);
+}
+
+TEST(multiset_lookup, bounds_many) {
+  s21::multiset<int> my_mset;
+  std::multiset<int> std_mset;
+  for (int i = 0; i < 1000; ++i) {
+    my_mset.insert((i * 37) % 101);
+    std_mset.insert((i * 37) % 101);
+  }
+
+  for (int key = -1; key <= 101; ++key) {
+    auto my_range = my_mset.equal_range(key);
+    auto std_range = std_mset.equal_range(key);
+    EXPECT_EQ(my_mset.count(key), std_mset.count(key));
+    EXPECT_EQ(my_range.first == my_mset.end(),
+              std_range.first == std_mset.end());
+    if (std_range.first != std_mset.end()) {
+      EXPECT_EQ(*my_range.first, *std_range.first);
+    }
+    if (std_range.second != std_mset.end()) {
+      EXPECT_EQ(*my_range.second, *std_range.second);
+    }
+  }
+}
+
+TEST(multiset_compare, equal_keys_keep_insertion_order) {
+  struct ByFirst {
+    using is_transparent = void;
+    bool operator()(const std::pair<int, int> &a,
+                    const std::pair<int, int> &b) const {
+      return a.first < b.first;
+    }
+    bool operator()(int a, const std::pair<int, int> &b) const {
+      return a < b.first;
+    }
+    bool operator()(const std::pair<int, int> &a, int b) const {
+      return a.first < b;
+    }
+  };
+  s21::multiset<std::pair<int, int>, ByFirst> ms;
+  for (int i = 0; i < 20; ++i) ms.insert({i % 3, i});
+
+  EXPECT_EQ(ms.count(1), 7U);
+  auto range = ms.equal_range(1);
+  int prev = -1;
+  for (auto it = range.first; it != range.second; ++it) {
+    EXPECT_EQ((*it).first, 1);
+    EXPECT_GT((*it).second, prev);
+    prev = (*it).second;
+  }
+  EXPECT_EQ((*ms.lower_bound(2)).second, 2);
+  EXPECT_TRUE(ms.upper_bound(2) == ms.end());
+  EXPECT_FALSE(ms.contains(3));
+}
+
+TEST(multiset_constructor, sorted_range) {
+  std::vector<int> keys{1, 1, 2, 3, 3, 3, 4};
+  s21::multiset<int> ms(keys.begin(), keys.end());
+  EXPECT_EQ(ms.size(), keys.size());
+  EXPECT_EQ(ms.count(3), 3U);
+  EXPECT_TRUE(std::equal(keys.begin(), keys.end(), ms.begin()));
+  ms.insert(3);
+  EXPECT_EQ(ms.count(3), 4U);
+}
+
+TEST(multiset_modifiers, insert_with_hint) {
+  s21::multiset<int> ms;
+  for (int i = 0; i < 100; ++i) ms.insert(ms.end(), i / 10);
+  EXPECT_EQ(ms.size(), 100U);
+  EXPECT_EQ(ms.count(4), 10U);
+
+  auto it = ms.insert(ms.lower_bound(4), 4);
+  EXPECT_TRUE(it == ms.lower_bound(4));
+  it = ms.emplace_hint(ms.begin(), 7);
+  EXPECT_EQ(*it, 7);
+  EXPECT_EQ(ms.count(4), 11U);
+  EXPECT_EQ(ms.count(7), 11U);
+  int prev = *ms.begin();
+  for (int value : ms) {
+    EXPECT_LE(prev, value);
+    prev = value;
+  }
+}
+
+TEST(multiset_lookup, order_statistics) {
+  s21::multiset<int, std::less<int>, true> ms;
+  std::vector<int> expected;
+  for (int i = 0; i < 1000; ++i) {
+    int value = (i * 7919) % 211;
+    ms.insert(value);
+    expected.push_back(value);
+  }
+  for (int value = 0; value < 211; value += 3) {
+    ms.erase(ms.find(value));
+    expected.erase(std::find(expected.begin(), expected.end(), value));
+  }
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(ms.size(), expected.size());
+
+  for (size_t i = 0; i < expected.size(); i += 17) {
+    EXPECT_EQ(*ms.nth(i), expected[i]);
+    EXPECT_EQ(ms.nth(i).index(), i);
+    EXPECT_EQ(*(ms.begin() + i), expected[i]);
+    EXPECT_EQ(*(ms.end() - (expected.size() - i)), expected[i]);
+  }
+  for (int value = -1; value <= 212; ++value) {
+    size_t rank = std::lower_bound(expected.begin(), expected.end(), value) -
+                  expected.begin();
+    EXPECT_EQ(ms.rank(value), rank);
+    EXPECT_EQ(ms.count(value), static_cast<size_t>(std::count(
+                                   expected.begin(), expected.end(), value)));
+  }
+  EXPECT_TRUE(ms.nth(expected.size()) == ms.end());
+  EXPECT_TRUE(ms.begin() + expected.size() == ms.end());
+  EXPECT_TRUE(ms.begin() - 1 == ms.end());
+  EXPECT_EQ(distance(ms.begin(), ms.end()),
+            static_cast<std::ptrdiff_t>(expected.size()));
+  EXPECT_EQ(distance(ms.lower_bound(100), ms.upper_bound(100)),
+            std::count(expected.begin(), expected.end(), 100));
+
+  auto median = ms.nth(expected.size() / 2);
+  EXPECT_EQ(*median, expected[expected.size() / 2]);
+}
+
 // ---------------- MAIN ---------------- //
@@ -158,4 +158,36 @@ TEST(queue, Swap) {
   EXPECT_EQ(queue_1.back(), queue_std_1.back());
   EXPECT_EQ(queue_1.size(), queue_std_1.size());
   EXPECT_EQ(queue_1.empty(), queue_std_1.empty());
-}
\ No newline at end of file
+}
+TEST(queue, Emplace) {
+  s21::queue<std::pair<int, std::string>> queue;
+  queue.emplace(1, "one");
+  queue.emplace(2, "two");
+  EXPECT_EQ(queue.size(), 2U);
+  EXPECT_EQ(queue.front().second, "one");
+  EXPECT_EQ(queue.back().first, 2);
+}
+TEST(queue, ListContainer) {
+  s21::queue<std::string, s21::list<std::string>> queue{"a", "b"};
+  queue.push("c");
+  queue.insert_many_back("d", "e");
+  queue.pop();
+  EXPECT_EQ(queue.size(), 4U);
+  EXPECT_EQ(queue.front(), "b");
+  EXPECT_EQ(queue.back(), "e");
+}
+TEST(queue, WrapsAround) {
+  s21::queue<int> queue;
+  std::queue<int> queue_std;
+  for (int i = 0; i < 1000; ++i) {
+    queue.push(i);
+    queue_std.push(i);
+    if (i % 3 != 0) {
+      queue.pop();
+      queue_std.pop();
+    }
+    EXPECT_EQ(queue.front(), queue_std.front());
+    EXPECT_EQ(queue.back(), queue_std.back());
+  }
+  EXPECT_EQ(queue.size(), queue_std.size());
+}
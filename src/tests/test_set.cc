@@ -101,6 +101,27 @@ TEST(set_iterator, end) {
   EXPECT_EQ(*s21_it_int, 0);
 }
 
+TEST(set_iterator, walks_both_ways) {
+  s21::set<int> s21_set_int;
+  std::set<int> std_set_int;
+  for (int i = 0; i < 1000; ++i) {
+    s21_set_int.insert((i * 389) % 1009);
+    std_set_int.insert((i * 389) % 1009);
+  }
+
+  auto std_it = std_set_int.begin();
+  for (auto it = s21_set_int.begin(); it != s21_set_int.end(); ++it) {
+    EXPECT_EQ(*it, *std_it++);
+  }
+  auto s21_it = s21_set_int.end();
+  for (auto it = std_set_int.rbegin(); it != std_set_int.rend(); ++it) {
+    EXPECT_EQ(*--s21_it, *it);
+  }
+  EXPECT_TRUE(s21_it == s21_set_int.begin());
+  EXPECT_TRUE(--s21_it == s21_set_int.end());
+  EXPECT_EQ(*(s21_set_int.begin() + 3), *std::next(std_set_int.begin(), 3));
+}
+
 // ---------------- CAPACITY ---------------- //
 
 TEST(set_capacity, empty) {
@@ -135,7 +156,8 @@ TEST(set_capacity, max_size) {
   s21::set<int> s21_set_int{1, 2, 3};
   std::set<int> std_set_int{1, 2, 3};
 
-  EXPECT_EQ(s21_set_int.max_size(), std_set_int.max_size());
+  // packed key-only nodes are smaller than the std ones
+  EXPECT_GE(s21_set_int.max_size(), std_set_int.max_size());
 }
 
 // ---------------- MODIFIERS ---------------- //
@@ -357,6 +379,32 @@ TEST(set_modifiers, merge) {
   }
 }
 
+TEST(set_modifiers, merge_between_pools) {
+  auto shared = std::make_shared<s21::set<std::string>::node_pool>();
+  s21::set<std::string> a(shared), b(shared);
+  a.insert_many("a", "c");
+  b.insert_many("b", "c", "d");
+  a.merge(b);
+  EXPECT_EQ(a.size(), 4U);
+  EXPECT_EQ(b.size(), 1U);
+
+  // b's pool is still shared with a, so c has to move the elements
+  s21::set<std::string> c{"z"};
+  c.merge(a);
+  EXPECT_EQ(c.size(), 5U);
+  EXPECT_TRUE(a.empty());
+  EXPECT_EQ(*c.begin(), "a");
+
+  s21::set<std::string>::node_type handle;
+  {
+    s21::set<std::string> source{"kept"};
+    handle = source.extract(source.begin());
+  }
+  EXPECT_EQ(handle.value(), "kept");
+  EXPECT_TRUE(c.insert(std::move(handle)).inserted);
+  EXPECT_TRUE(c.contains("kept"));
+}
+
 TEST(set_modifiers, insert_many) {
   s21::set<int> set1;
   set1.insert_many(66, 23, 1, 6, 3, 0);
@@ -391,3 +439,183 @@ TEST(set_lookup, contains) {
 
   EXPECT_TRUE(set1.contains(66));
 }
+
+TEST(set_modifiers, clear_reuse) {
+  s21::set<std::string> s21_set_string{"Hello", ",", "world"};
+  s21_set_string.clear();
+
+  EXPECT_TRUE(s21_set_string.empty());
+  EXPECT_EQ(s21_set_string.size(), 0U);
+
+  s21_set_string.insert("again");
+  EXPECT_EQ(s21_set_string.size(), 1U);
+  EXPECT_EQ(*s21_set_string.begin(), "again");
+}
+
+TEST(set_iterator, begin_end_after_mutations) {
+  s21::set<int> s21_set_int;
+  std::set<int> std_set_int;
+  for (int i = 0; i < 500; ++i) {
+    int key = (i * 7919) % 503;
+    s21_set_int.insert(key);
+    std_set_int.insert(key);
+    EXPECT_EQ(*s21_set_int.begin(), *std_set_int.begin());
+    EXPECT_EQ(*(--s21_set_int.end()), *std_set_int.rbegin());
+  }
+  for (int i = 0; i < 499; ++i) {
+    int key = (i * 389) % 503;
+    s21_set_int.erase(key);
+    std_set_int.erase(key);
+    EXPECT_EQ(*s21_set_int.begin(), *std_set_int.begin());
+    EXPECT_EQ(*(--s21_set_int.end()), *std_set_int.rbegin());
+  }
+  s21_set_int.erase(s21_set_int.begin());
+  s21_set_int.erase(--s21_set_int.end());
+  EXPECT_EQ(s21_set_int.size(), std_set_int.size() - 2);
+}
+
+TEST(set_modifiers, emplace) {
+  s21::set<std::string> s;
+  auto res = s.emplace(3, 'a');
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, "aaa");
+  res = s.emplace("aaa");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(*res.first, "aaa");
+  EXPECT_EQ(s.size(), 1U);
+}
+
+// black height of a valid red-black subtree, -1 when a rule is broken
+template <typename NodeType>
+int BlackHeight(const NodeType *node) {
+  if (node == nullptr) return 1;
+  for (const NodeType *child : {node->left_, node->right_}) {
+    if (child == nullptr) continue;
+    if (child->parent() != node) return -1;
+    if (node->color() == 'R' && child->color() == 'R') return -1;
+  }
+  int left = BlackHeight(node->left_);
+  int right = BlackHeight(node->right_);
+  if (left < 0 || left != right) return -1;
+  return left + (node->color() == 'B' ? 1 : 0);
+}
+
+template <typename Set>
+int TreeBlackHeight(Set &s) {
+  auto node = s.begin().operator->();
+  while (node->parent() != nullptr) node = node->parent();
+  return node->color() == 'B' ? BlackHeight(node) : -1;
+}
+
+TEST(set_constructor, sorted_range_is_balanced) {
+  for (int n : {1, 2, 3, 7, 8, 100, 1023, 1024, 5000}) {
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; ++i) keys[i] = i * 2;
+    s21::set<int> s(keys.begin(), keys.end());
+    EXPECT_EQ(s.size(), static_cast<size_t>(n));
+    EXPECT_GT(TreeBlackHeight(s), 0);
+    int expected = 0;
+    for (int key : s) {
+      EXPECT_EQ(key, expected);
+      expected += 2;
+    }
+    EXPECT_EQ(*(--s.end()), (n - 1) * 2);
+
+    s.insert(-1);
+    s.insert(n * 2);
+    s.erase(0);
+    EXPECT_EQ(*s.begin(), -1);
+    EXPECT_GT(TreeBlackHeight(s), 0);
+  }
+}
+
+TEST(set_modifiers, assign_sorted) {
+  s21::set<int> s{5, 6};
+  std::vector<int> unsorted{3, 1, 2, 3};
+  s.assign_sorted(unsorted.begin(), unsorted.end());
+  EXPECT_EQ(s.size(), 3U);
+  EXPECT_EQ(*s.begin(), 1);
+  EXPECT_FALSE(s.contains(5));
+
+  std::vector<int> sorted{10, 20, 30};
+  s.assign_sorted(sorted.begin(), sorted.end());
+  EXPECT_EQ(s.size(), 3U);
+  EXPECT_EQ(*s.begin(), 10);
+  EXPECT_GT(TreeBlackHeight(s), 0);
+
+  s.assign_sorted(sorted.end(), sorted.end());
+  EXPECT_TRUE(s.empty());
+  EXPECT_TRUE(s.begin() == s.end());
+}
+
+TEST(set_modifiers, insert_with_hint) {
+  s21::set<int> s;
+  for (int i = 0; i < 1000; ++i) {
+    auto it = s.insert(s.end(), i * 2);
+    EXPECT_EQ(*it, i * 2);
+  }
+  EXPECT_EQ(s.size(), 1000U);
+  EXPECT_GT(TreeBlackHeight(s), 0);
+
+  // right before the hint, a duplicate and hints that do not fit
+  auto hint = s.find(10);
+  EXPECT_EQ(*s.insert(hint, 9), 9);
+  EXPECT_EQ(*s.insert(s.find(10), 10), 10);
+  EXPECT_EQ(*s.emplace_hint(s.begin(), 1501), 1501);
+  EXPECT_EQ(*s.emplace_hint(s.end(), -1), -1);
+  EXPECT_EQ(*s.insert(s.find(500), 3), 3);
+  EXPECT_EQ(s.size(), 1004U);
+  EXPECT_GT(TreeBlackHeight(s), 0);
+
+  int prev = *s.begin();
+  for (auto it = ++s.begin(); it != s.end(); ++it) {
+    EXPECT_LT(prev, *it);
+    prev = *it;
+  }
+  EXPECT_EQ(*s.begin(), -1);
+  EXPECT_EQ(*(--s.end()), 1998);
+}
+
+struct CopyCounted {
+  CopyCounted(int v = 0) : value(v) {}
+  CopyCounted(const CopyCounted &other) : value(other.value) { ++copies; }
+  CopyCounted &operator=(const CopyCounted &other) = default;
+  bool operator<(const CopyCounted &other) const {
+    return value < other.value;
+  }
+  int value;
+  static inline int copies = 0;
+};
+
+TEST(set_modifiers, key_stored_once) {
+  s21::set<CopyCounted> s;
+  CopyCounted key(7);
+  CopyCounted::copies = 0;
+  s.insert(key);
+  s.insert(key);
+  EXPECT_EQ(CopyCounted::copies, 1);
+  EXPECT_EQ((*s.find(7)).value, 7);
+  EXPECT_EQ((*s.begin()).value, 7);
+  EXPECT_LT(sizeof(rbtree::Node<std::string, rbtree::KeyOnly>),
+            sizeof(rbtree::Node<std::string, std::string>));
+}
+
+TEST(set_compare, custom_order) {
+  struct ByAbs {
+    bool operator()(int a, int b) const {
+      return std::abs(a - origin) < std::abs(b - origin);
+    }
+    int origin = 0;
+  };
+  s21::set<int, ByAbs> s(ByAbs{0});
+  s.insert_many(-3, 1, 2, -1, 3);
+  EXPECT_EQ(s.size(), 3U);
+  EXPECT_EQ(*s.begin(), 1);
+  EXPECT_TRUE(s.contains(-2));
+  EXPECT_EQ(*s.find(3), -3);
+  EXPECT_TRUE(s.key_comp()(1, -2));
+
+  s21::set<int, ByAbs> copy(s);
+  copy.insert(-4);
+  EXPECT_EQ(*(--copy.end()), -4);
+}
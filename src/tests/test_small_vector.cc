@@ -0,0 +1,125 @@
+#include "test_main.h"
+
+namespace {
+using counted_string = s21_test::CountingAllocator<std::string>;
+using small_strings = s21::small_vector<std::string, 4, counted_string>;
+}  // namespace
+
+TEST(small_vector_constructor, case1) {
+  s21::small_vector<int, 8> s21_vec;
+  EXPECT_TRUE(s21_vec.empty());
+  EXPECT_EQ(s21_vec.size(), 0U);
+  EXPECT_EQ(s21_vec.capacity(), 8U);
+
+  s21::small_vector<std::string, 2> s21_vec_string(5);
+  EXPECT_EQ(s21_vec_string.size(), 5U);
+  EXPECT_EQ(s21_vec_string.capacity(), 5U);
+  EXPECT_EQ(s21_vec_string[4], "");
+
+  s21::small_vector<int, 0> s21_vec_empty{1, 2, 3};
+  EXPECT_EQ(s21_vec_empty.size(), 3U);
+  EXPECT_EQ(s21_vec_empty.back(), 3);
+}
+
+TEST(small_vector_constructor, copy_and_move) {
+  s21::small_vector<std::string, 3> small{"a", "b"};
+  s21::small_vector<std::string, 3> big{"a", "b", "c", "d", "e"};
+
+  auto small_copy = small;
+  auto big_copy = big;
+  EXPECT_EQ(small_copy.size(), 2U);
+  EXPECT_EQ(big_copy[4], "e");
+
+  const std::string *heap = big.data();
+  auto big_moved = std::move(big);
+  EXPECT_EQ(big_moved.data(), heap);
+  EXPECT_TRUE(big.empty());
+  EXPECT_EQ(big.capacity(), 3U);
+
+  auto small_moved = std::move(small);
+  EXPECT_NE(small_moved.data(), small.data());
+  EXPECT_EQ(small_moved[1], "b");
+  EXPECT_TRUE(small.empty());
+
+  small = std::move(big_moved);
+  EXPECT_EQ(small.size(), 5U);
+  EXPECT_EQ(small.data(), heap);
+  big_moved = small_moved;
+  EXPECT_EQ(big_moved.size(), 2U);
+  EXPECT_EQ(big_moved.capacity(), 3U);
+}
+
+TEST(small_vector_storage, no_allocation_up_to_n) {
+  counted_string::allocations = 0;
+  {
+    small_strings s21_vec;
+    for (int i = 0; i < 4; ++i) {
+      s21_vec.push_back(std::to_string(i));
+    }
+    s21_vec.insert(s21_vec.begin(), "x");
+    EXPECT_EQ(counted_string::allocations, 1);
+    s21_vec.erase(s21_vec.begin());
+    s21_vec.pop_back();
+    s21_vec.shrink_to_fit();
+    EXPECT_EQ(counted_string::live, 0);
+    EXPECT_EQ(s21_vec.capacity(), 4U);
+    EXPECT_EQ(s21_vec[0], "0");
+    EXPECT_EQ(s21_vec[2], "2");
+
+    s21_vec.insert_many_back("3");
+    s21_vec.clear();
+    s21_vec.emplace_back(3, 'z');
+    EXPECT_EQ(s21_vec.front(), "zzz");
+    EXPECT_EQ(counted_string::allocations, 1);
+  }
+  EXPECT_EQ(counted_string::live, 0);
+}
+
+TEST(small_vector_storage, spills_to_heap) {
+  counted_string::allocations = 0;
+  {
+    small_strings s21_vec;
+    std::vector<std::string> std_vec;
+    for (int i = 0; i < 100; ++i) {
+      s21_vec.push_back(std::to_string(i));
+      std_vec.push_back(std::to_string(i));
+    }
+    EXPECT_EQ(s21_vec.size(), std_vec.size());
+    EXPECT_TRUE(std::equal(s21_vec.begin(), s21_vec.end(), std_vec.begin()));
+    EXPECT_EQ(counted_string::live, 1);
+    EXPECT_LT(counted_string::allocations, 15);
+    EXPECT_THROW(s21_vec.at(100), std::out_of_range);
+  }
+  EXPECT_EQ(counted_string::live, 0);
+}
+
+TEST(small_vector_modifiers, swap) {
+  s21::small_vector<std::string, 2> inline_vec{"a"};
+  s21::small_vector<std::string, 2> heap_vec{"b", "c", "d"};
+  s21::small_vector<std::string, 2> heap_other{"e", "f", "g", "h"};
+
+  inline_vec.swap(heap_vec);
+  EXPECT_EQ(inline_vec.size(), 3U);
+  EXPECT_EQ(inline_vec[2], "d");
+  EXPECT_EQ(heap_vec.size(), 1U);
+  EXPECT_EQ(heap_vec[0], "a");
+
+  const std::string *first = inline_vec.data();
+  const std::string *second = heap_other.data();
+  inline_vec.swap(heap_other);
+  EXPECT_EQ(inline_vec.data(), second);
+  EXPECT_EQ(heap_other.data(), first);
+  EXPECT_EQ(inline_vec[3], "h");
+}
+
+TEST(small_vector_modifiers, insert_self_reference) {
+  s21::small_vector<std::string, 3> s21_vec{"Hello", "world"};
+  s21_vec.insert(s21_vec.begin(), s21_vec[1]);
+  s21_vec.push_back(s21_vec[0]);
+  s21_vec.insert_many(s21_vec.begin() + 1, s21_vec[3], s21_vec[1]);
+
+  std::vector<std::string> expected{"world", "world", "Hello", "Hello",
+                                    "world", "world"};
+  EXPECT_EQ(s21_vec.size(), expected.size());
+  EXPECT_TRUE(std::equal(s21_vec.begin(), s21_vec.end(), expected.begin()));
+}
@@ -147,4 +147,21 @@ TEST(Stack, Swap) {
   EXPECT_EQ(stack_1.top(), stack_std_1.top());
   EXPECT_EQ(stack_1.size(), stack_std_1.size());
   EXPECT_EQ(stack.empty(), stack_std.empty());
-}
\ No newline at end of file
+}
+TEST(stack, Emplace) {
+  s21::stack<std::pair<int, std::string>> stack;
+  stack.emplace(1, "one");
+  std::pair<int, std::string> two(2, "two");
+  stack.push(std::move(two));
+  EXPECT_EQ(stack.size(), 2U);
+  EXPECT_EQ(stack.top().second, "two");
+  EXPECT_TRUE(two.second.empty());
+}
+TEST(stack, ListContainer) {
+  s21::stack<std::string, s21::list<std::string>> stack{"a", "b"};
+  stack.push("c");
+  stack.insert_many_front("y", "z");
+  stack.pop();
+  EXPECT_EQ(stack.size(), 4U);
+  EXPECT_EQ(stack.top(), "b");
+}
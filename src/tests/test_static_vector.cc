@@ -0,0 +1,106 @@
+#include "test_main.h"
+
+namespace {
+constexpr s21::static_vector<int, 8> squares(int count) {
+  s21::static_vector<int, 8> res;
+  for (int i = 0; res.try_push_back(i * i) && i < count; ++i) {
+  }
+  res.pop_back();
+  return res;
+}
+}  // namespace
+
+TEST(static_vector_constructor, case1) {
+  s21::static_vector<int, 4> s21_vec_int;
+  s21::static_vector<std::string, 4> s21_vec_string(3);
+  s21::static_vector<double, 4> s21_vec_double{1.5, 2.5};
+
+  EXPECT_TRUE(s21_vec_int.empty());
+  EXPECT_EQ(s21_vec_int.capacity(), 4U);
+  EXPECT_EQ(s21_vec_string.size(), 3U);
+  EXPECT_EQ(s21_vec_string[2], "");
+  EXPECT_EQ(s21_vec_double.back(), 2.5);
+
+  EXPECT_THROW((s21::static_vector<int, 2>(3)), std::length_error);
+  EXPECT_THROW((s21::static_vector<int, 2>{1, 2, 3}), std::length_error);
+  EXPECT_THROW(s21_vec_int.reserve(5), std::length_error);
+  EXPECT_THROW(s21_vec_double.at(2), std::out_of_range);
+}
+
+TEST(static_vector_constructor, copy_and_move) {
+  s21::static_vector<std::string, 4> s21_vec{"a", "b", "c"};
+  auto copy = s21_vec;
+  auto moved = std::move(s21_vec);
+  EXPECT_TRUE(s21_vec.empty());
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_EQ(moved[2], "c");
+
+  copy.pop_back();
+  moved = copy;
+  EXPECT_EQ(moved.size(), 2U);
+  s21_vec = std::move(moved);
+  EXPECT_EQ(s21_vec[1], "b");
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(static_vector_inline, no_heap) {
+  static_assert(sizeof(s21::static_vector<int, 16>) ==
+                16 * sizeof(int) + sizeof(size_t));
+  static_assert(noexcept(std::declval<s21::static_vector<int, 2> &>()
+                             .push_back(1)));
+  static_assert(std::is_trivially_destructible<
+                s21::static_vector<int, 2>>::value);
+
+  constexpr s21::static_vector<int, 8> s21_vec = squares(5);
+  static_assert(s21_vec.size() == 5);
+  static_assert(s21_vec[4] == 16);
+  static_assert(squares(20).size() == 7);
+}
+
+TEST(static_vector_modifiers, try_push_back) {
+  s21::static_vector<std::string, 2> s21_vec;
+  std::string value = "kept";
+  EXPECT_TRUE(s21_vec.try_push_back("a"));
+  EXPECT_TRUE(s21_vec.try_push_back(value));
+  EXPECT_FALSE(s21_vec.try_push_back(std::move(value)));
+  EXPECT_EQ(value, "kept");
+  EXPECT_EQ(s21_vec.size(), 2U);
+  EXPECT_EQ(s21_vec.back(), "kept");
+}
+
+TEST(static_vector_modifiers, insert_erase) {
+  s21::static_vector<std::string, 8> s21_vec{"b", "d"};
+  std::vector<std::string> std_vec{"b", "d"};
+
+  s21_vec.insert(s21_vec.begin(), s21_vec[1]);
+  std_vec.insert(std_vec.begin(), std::string("d"));
+  s21_vec.emplace(s21_vec.begin() + 2, 1, 'c');
+  std_vec.emplace(std_vec.begin() + 2, 1, 'c');
+  s21_vec.insert_many(s21_vec.begin() + 1, s21_vec[0], "x");
+  std_vec.insert(std_vec.begin() + 1, {"d", "x"});
+  s21_vec.insert_many_back("e");
+  std_vec.push_back("e");
+  s21_vec.erase(s21_vec.begin());
+  std_vec.erase(std_vec.begin());
+
+  EXPECT_EQ(s21_vec.size(), std_vec.size());
+  EXPECT_TRUE(std::equal(s21_vec.begin(), s21_vec.end(), std_vec.begin()));
+
+  s21_vec.clear();
+  EXPECT_TRUE(s21_vec.empty());
+}
+
+TEST(static_vector_modifiers, swap) {
+  s21::static_vector<std::string, 4> first{"a", "b", "c"};
+  s21::static_vector<std::string, 4> second{"x"};
+
+  first.swap(second);
+  EXPECT_EQ(first.size(), 1U);
+  EXPECT_EQ(first[0], "x");
+  EXPECT_EQ(second.size(), 3U);
+  EXPECT_EQ(second[2], "c");
+
+  first.swap(second);
+  EXPECT_EQ(first[1], "b");
+  EXPECT_EQ(second.front(), "x");
+}
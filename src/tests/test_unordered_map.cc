@@ -0,0 +1,148 @@
+#include "test_main.h"
+
+TEST(unordered_map_constructor, init_list_and_copy) {
+  s21::unordered_map<int, std::string> s21_map{{1, "one"}, {2, "two"}};
+  s21::unordered_map<int, std::string> s21_copy(s21_map);
+  s21::unordered_map<int, std::string> s21_moved(std::move(s21_map));
+
+  EXPECT_EQ(s21_copy.size(), 2U);
+  EXPECT_EQ(s21_copy.at(1), "one");
+  EXPECT_EQ(s21_moved.at(2), "two");
+  EXPECT_TRUE(s21_map.empty());
+  EXPECT_THROW(s21_copy.at(3), std::out_of_range);
+}
+
+TEST(unordered_map_modifiers, insert_find_erase_like_std) {
+  s21::unordered_map<int, int> s21_map;
+  std::unordered_map<int, int> std_map;
+  unsigned seed = 7;
+  for (int i = 0; i < 20000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>(seed % 5000);
+    if (seed & 0x10000) {
+      bool inserted = s21_map.insert(key, i).second;
+      EXPECT_EQ(inserted, std_map.insert({key, i}).second);
+    } else {
+      s21_map.erase(key);
+      std_map.erase(key);
+    }
+  }
+  ASSERT_EQ(s21_map.size(), std_map.size());
+  for (const auto &item : std_map) {
+    auto it = s21_map.find(item.first);
+    ASSERT_NE(it, s21_map.end());
+    EXPECT_EQ((*it).second, item.second);
+  }
+  size_t visited = 0;
+  for (auto it = s21_map.begin(); it != s21_map.end(); ++it) {
+    EXPECT_EQ(std_map.at((*it).first), (*it).second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, std_map.size());
+  for (int key = 0; key < 5000; ++key) {
+    EXPECT_EQ(s21_map.contains(key), std_map.count(key) == 1);
+  }
+}
+
+TEST(unordered_map_modifiers, erase_keeps_probe_runs) {
+  s21::unordered_map<int, int> s21_map;
+  for (int i = 0; i < 1000; ++i) {
+    s21_map[i] = i;
+  }
+  size_t buckets = s21_map.bucket_count();
+  for (int i = 0; i < 1000; i += 2) {
+    s21_map.erase(s21_map.find(i));
+  }
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(s21_map.contains(i), i % 2 == 1);
+  }
+  for (int i = 1000; i < 1400; ++i) {
+    s21_map[i] = i;
+  }
+  EXPECT_EQ(s21_map.size(), 900U);
+  EXPECT_EQ(s21_map.bucket_count(), buckets);
+}
+
+TEST(unordered_map_modifiers, emplace_and_try_emplace) {
+  s21::unordered_map<std::string, std::unique_ptr<int>> s21_map;
+  auto value = std::make_unique<int>(1);
+  EXPECT_TRUE(s21_map.try_emplace("a", std::move(value)).second);
+  EXPECT_EQ(value, nullptr);
+  value = std::make_unique<int>(2);
+  EXPECT_FALSE(s21_map.try_emplace("a", std::move(value)).second);
+  EXPECT_NE(value, nullptr);
+  EXPECT_TRUE(s21_map.emplace("b", std::make_unique<int>(3)).second);
+  EXPECT_EQ(*s21_map.at("b"), 3);
+  EXPECT_EQ(s21_map["c"], nullptr);
+  EXPECT_EQ(s21_map.size(), 3U);
+
+  s21::unordered_map<int, int> s21_ints;
+  s21_ints.insert_or_assign(1, 1);
+  s21_ints.insert_or_assign(1, 2);
+  auto res = s21_ints.insert_many(std::pair<int, int>(2, 2),
+                                  std::pair<int, int>(1, 5));
+  EXPECT_TRUE(res[0].second);
+  EXPECT_FALSE(res[1].second);
+  EXPECT_EQ(s21_ints.at(1), 2);
+}
+
+TEST(unordered_map_modifiers, merge_and_swap) {
+  s21::unordered_map<int, int> first{{1, 1}, {2, 2}};
+  s21::unordered_map<int, int> second{{2, 20}, {3, 30}};
+  first.merge(second);
+  EXPECT_EQ(first.size(), 3U);
+  EXPECT_EQ(first.at(2), 2);
+  EXPECT_EQ(first.at(3), 30);
+  EXPECT_EQ(second.size(), 1U);
+  EXPECT_EQ(second.at(2), 20);
+  first.swap(second);
+  EXPECT_EQ(first.size(), 1U);
+  EXPECT_EQ(second.size(), 3U);
+}
+
+TEST(unordered_map_hash_policy, reserve_rehash_load_factor) {
+  s21::unordered_map<int, int> s21_map;
+  EXPECT_EQ(s21_map.bucket_count(), 0U);
+  s21_map.reserve(1000);
+  size_t buckets = s21_map.bucket_count();
+  EXPECT_GE(buckets * s21_map.max_load_factor(), 1000.0f);
+  for (int i = 0; i < 1000; ++i) {
+    s21_map.insert(i, -i);
+  }
+  EXPECT_EQ(s21_map.bucket_count(), buckets);
+  EXPECT_LE(s21_map.load_factor(), s21_map.max_load_factor());
+
+  s21_map.max_load_factor(0.5f);
+  EXPECT_LE(s21_map.load_factor(), 0.5f);
+  EXPECT_THROW(s21_map.max_load_factor(1.5f), std::invalid_argument);
+  s21_map.rehash(100000);
+  EXPECT_GE(s21_map.bucket_count(), 100000U);
+  EXPECT_EQ(s21_map.at(999), -999);
+  s21_map.clear();
+  s21_map.rehash(0);
+  EXPECT_EQ(s21_map.bucket_count(), 0U);
+  EXPECT_FALSE(s21_map.contains(1));
+}
+
+namespace {
+struct StringHash {
+  using is_transparent = void;
+  size_t operator()(const std::string &s) const {
+    return std::hash<std::string>()(s);
+  }
+  size_t operator()(const char *s) const {
+    return std::hash<std::string>()(s);
+  }
+};
+}  // namespace
+
+TEST(unordered_map_lookup, heterogeneous_find) {
+  s21::unordered_map<std::string, int, StringHash, std::equal_to<>> s21_map{
+      {"alpha", 1}, {"beta", 2}};
+  const char *key = "beta";
+  auto it = s21_map.find(key);
+  ASSERT_NE(it, s21_map.end());
+  EXPECT_EQ((*it).second, 2);
+  EXPECT_TRUE(s21_map.contains("alpha"));
+  EXPECT_FALSE(s21_map.contains("gamma"));
+}
@@ -0,0 +1,110 @@
+#include "test_main.h"
+
+namespace {
+struct ThrowingHash {
+  static inline bool armed = false;
+  size_t operator()(int key) const {
+    if (armed) throw std::runtime_error("hash");
+    return std::hash<int>()(key);
+  }
+};
+}  // namespace
+
+TEST(unordered_set_constructor, init_list_copy_move) {
+  s21::unordered_set<std::string> s21_set{"a", "b", "c", "a"};
+  s21::unordered_set<std::string> s21_copy(s21_set);
+  s21::unordered_set<std::string> s21_moved;
+  s21_moved = std::move(s21_set);
+
+  EXPECT_EQ(s21_copy.size(), 3U);
+  EXPECT_EQ(s21_moved.size(), 3U);
+  EXPECT_TRUE(s21_set.empty());
+  EXPECT_TRUE(s21_copy.contains("c"));
+  EXPECT_EQ(s21_moved.count("d"), 0U);
+}
+
+TEST(unordered_set_modifiers, insert_erase_like_std) {
+  s21::unordered_set<long> s21_set;
+  std::unordered_set<long> std_set;
+  unsigned seed = 99;
+  for (int i = 0; i < 30000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    long key = static_cast<long>(seed % 3000) * 4096;
+    if (seed & 0x20000) {
+      EXPECT_EQ(s21_set.insert(key).second, std_set.insert(key).second);
+    } else {
+      s21_set.erase(key);
+      std_set.erase(key);
+    }
+  }
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  for (long key : s21_set) {
+    EXPECT_EQ(std_set.count(key), 1U);
+  }
+  for (long key = 0; key < 3000; ++key) {
+    EXPECT_EQ(s21_set.contains(key * 4096), std_set.count(key * 4096) == 1);
+  }
+}
+
+TEST(unordered_set_modifiers, emplace_merge_insert_many) {
+  s21::unordered_set<std::string> s21_set;
+  auto res = s21_set.emplace(3, 'x');
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(*res.first, "xxx");
+  EXPECT_FALSE(s21_set.emplace("xxx").second);
+
+  auto many = s21_set.insert_many("a", "b", "xxx");
+  EXPECT_TRUE(many[0].second);
+  EXPECT_TRUE(many[1].second);
+  EXPECT_FALSE(many[2].second);
+
+  s21::unordered_set<std::string> other{"b", "c"};
+  s21_set.merge(other);
+  EXPECT_EQ(s21_set.size(), 4U);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_TRUE(other.contains("b"));
+
+  s21_set.erase(s21_set.find("a"));
+  EXPECT_FALSE(s21_set.contains("a"));
+  s21_set.clear();
+  EXPECT_TRUE(s21_set.empty());
+  EXPECT_EQ(s21_set.begin(), s21_set.end());
+}
+
+TEST(unordered_set_hash_policy, grows_with_load_factor) {
+  s21::unordered_set<int> s21_set(100);
+  size_t buckets = s21_set.bucket_count();
+  EXPECT_GE(buckets, 100U);
+  s21_set.max_load_factor(0.25f);
+  for (int i = 0; i < 1000; ++i) {
+    s21_set.insert(i);
+    EXPECT_LE(s21_set.load_factor(), 0.25f);
+  }
+  EXPECT_GT(s21_set.bucket_count(), buckets);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(s21_set.contains(i));
+  }
+}
+
+TEST(unordered_set_modifiers, erase_with_throwing_hash) {
+  s21::unordered_set<int, ThrowingHash> s21_set;
+  for (int i = 0; i < 100; ++i) s21_set.insert(i);
+  ThrowingHash::armed = true;
+  int thrown = 0;
+  for (int i = 0; i < 10; ++i) {
+    try {
+      s21_set.erase(s21_set.begin());
+    } catch (const std::runtime_error &) {
+      ++thrown;
+    }
+  }
+  ThrowingHash::armed = false;
+  EXPECT_GT(thrown, 0);
+  EXPECT_EQ(s21_set.size(), 90U);
+  std::vector<int> left;
+  for (int key : s21_set) left.push_back(key);
+  EXPECT_EQ(left.size(), 90U);
+
+  s21_set.rehash(1000);
+  for (int key : left) EXPECT_TRUE(s21_set.contains(key));
+}
@@ -576,3 +576,200 @@ TEST(vector_swap, case1) {
   EXPECT_EQ(s21_vec_res_string.capacity(), 4U);
   EXPECT_EQ(s21_vec_res_string[2], "world");
 }
+
+namespace {
+struct Tracked {
+  static int defaults, copies, moves, assigns;
+  int value = 0;
+  Tracked() { ++defaults; }
+  Tracked(int v) : value(v) {}
+  Tracked(const Tracked &other) : value(other.value) { ++copies; }
+  Tracked(Tracked &&other) noexcept : value(other.value) { ++moves; }
+  Tracked &operator=(const Tracked &) = default;
+  Tracked &operator=(Tracked &&other) noexcept {
+    value = other.value;
+    ++assigns;
+    return *this;
+  }
+  static void reset() { defaults = copies = moves = assigns = 0; }
+};
+int Tracked::defaults = 0;
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+int Tracked::assigns = 0;
+}  // namespace
+
+TEST(vector_growth, no_redundant_constructions) {
+  Tracked::reset();
+  s21::vector<Tracked> s21_vec;
+  Tracked value(7);
+  for (int i = 0; i < 100; ++i) {
+    s21_vec.push_back(value);
+  }
+
+  EXPECT_EQ(Tracked::defaults, 0);
+  EXPECT_EQ(Tracked::copies, 100);
+  EXPECT_EQ(s21_vec.size(), 100U);
+  EXPECT_EQ(s21_vec[99].value, 7);
+
+  Tracked::reset();
+  s21_vec.reserve(1000);
+  EXPECT_EQ(Tracked::defaults, 0);
+  EXPECT_EQ(Tracked::copies, 0);
+  EXPECT_EQ(Tracked::moves, 100);
+}
+
+TEST(vector_growth, push_back_self_reference) {
+  s21::vector<std::string> s21_vec_string{"Hello"};
+  for (int i = 0; i < 10; ++i) {
+    s21_vec_string.push_back(s21_vec_string[0]);
+    s21_vec_string.insert(s21_vec_string.begin(), s21_vec_string.back());
+  }
+
+  EXPECT_EQ(s21_vec_string.size(), 21U);
+  for (auto &item : s21_vec_string) {
+    EXPECT_EQ(item, "Hello");
+  }
+}
+
+TEST(vector_allocator, custom_allocator) {
+  using counted = s21_test::CountingAllocator<std::string>;
+  counted::allocations = 0;
+  {
+    s21::vector<std::string, counted> s21_vec_string;
+    for (int i = 0; i < 50; ++i) {
+      s21_vec_string.push_back(std::to_string(i));
+    }
+    auto copy = s21_vec_string;
+    copy.erase(copy.begin());
+
+    EXPECT_GT(counted::allocations, 0);
+    EXPECT_EQ(counted::live, 2);
+    EXPECT_EQ(copy.size(), 49U);
+    EXPECT_EQ(copy[0], "1");
+    EXPECT_EQ(s21_vec_string[49], "49");
+  }
+  EXPECT_EQ(counted::live, 0);
+}
+
+namespace {
+struct Relocatable {
+  static int moves;
+  std::unique_ptr<int> value;
+  Relocatable(int v) : value(new int(v)) {}
+  Relocatable(const Relocatable &other) : value(new int(*other.value)) {}
+  Relocatable(Relocatable &&other) noexcept : value(std::move(other.value)) {
+    ++moves;
+  }
+  Relocatable &operator=(Relocatable &&other) noexcept {
+    value = std::move(other.value);
+    ++moves;
+    return *this;
+  }
+};
+int Relocatable::moves = 0;
+}  // namespace
+
+namespace s21 {
+template <>
+struct is_trivially_relocatable<Relocatable> : std::true_type {};
+}  // namespace s21
+
+TEST(vector_relocation, opt_in_trait) {
+  Relocatable::moves = 0;
+  s21::vector<Relocatable> s21_vec;
+  for (int i = 0; i < 100; ++i) {
+    s21_vec.push_back(Relocatable(i));
+  }
+  int pushed_moves = Relocatable::moves;
+  s21_vec.insert_many(s21_vec.begin() + 50, Relocatable(-1), Relocatable(-2));
+  s21_vec.erase(s21_vec.begin());
+  s21_vec.shrink_to_fit();
+
+  // one move into the vector per push_back, none when regrowing
+  EXPECT_EQ(pushed_moves, 100);
+  EXPECT_EQ(s21_vec.size(), 101U);
+  EXPECT_EQ(*s21_vec[0].value, 1);
+  EXPECT_EQ(*s21_vec[49].value, -1);
+  EXPECT_EQ(*s21_vec[50].value, -2);
+  EXPECT_EQ(*s21_vec[100].value, 99);
+}
+
+TEST(vector_insert_many, shifts_tail_once) {
+  s21::vector<Tracked> s21_vec;
+  s21_vec.reserve(103);
+  for (int i = 0; i < 100; ++i) {
+    s21_vec.emplace_back(i);
+  }
+  Tracked::reset();
+  s21_vec.insert_many(s21_vec.begin() + 10, 100, 101, 102);
+
+  EXPECT_EQ(Tracked::moves, 3);
+  EXPECT_EQ(Tracked::assigns, 90);
+  EXPECT_EQ(s21_vec[10].value, 100);
+  EXPECT_EQ(s21_vec[12].value, 102);
+  EXPECT_EQ(s21_vec[13].value, 10);
+  EXPECT_EQ(s21_vec[102].value, 99);
+
+  s21_vec.insert_many(s21_vec.end() - 1, 7, 8);
+  EXPECT_EQ(s21_vec[102].value, 7);
+  EXPECT_EQ(s21_vec[103].value, 8);
+  EXPECT_EQ(s21_vec[104].value, 99);
+}
+
+TEST(vector_insert_many, middle_and_self_reference) {
+  s21::vector<int> s21_vec_int{1, 2, 3, 4};
+  s21::vector<std::string> s21_vec_string{"a", "b", "c", "d"};
+  std::vector<int> std_vec_int{1, 2, 3, 4};
+  std::vector<std::string> std_vec_string{"a", "b", "c", "d"};
+
+  s21_vec_int.insert_many(s21_vec_int.begin() + 1, s21_vec_int[3], 7, 8);
+  std_vec_int.insert(std_vec_int.begin() + 1, {4, 7, 8});
+  s21_vec_string.insert_many(s21_vec_string.begin() + 2, s21_vec_string[0],
+                             std::string("x"));
+  std_vec_string.insert(std_vec_string.begin() + 2, {"a", "x"});
+  s21_vec_int.insert_many_back(9, s21_vec_int[0]);
+  std_vec_int.insert(std_vec_int.end(), {9, 1});
+
+  ASSERT_EQ(s21_vec_int.size(), std_vec_int.size());
+  for (size_t i = 0; i < std_vec_int.size(); ++i) {
+    EXPECT_EQ(s21_vec_int[i], std_vec_int[i]);
+  }
+  ASSERT_EQ(s21_vec_string.size(), std_vec_string.size());
+  for (size_t i = 0; i < std_vec_string.size(); ++i) {
+    EXPECT_EQ(s21_vec_string[i], std_vec_string[i]);
+  }
+}
+
+TEST(vector_erase, case3) {
+  s21::vector<int> s21_vec_int;
+  for (int i = 0; i < 1000; ++i) {
+    s21_vec_int.push_back(i);
+  }
+  for (int i = 0; i < 500; ++i) {
+    s21_vec_int.erase(s21_vec_int.begin() + i);
+  }
+
+  EXPECT_EQ(s21_vec_int.size(), 500U);
+  for (int i = 0; i < 500; ++i) {
+    EXPECT_EQ(s21_vec_int[i], 2 * i + 1);
+  }
+}
+
+TEST(vector_emplace, move_only) {
+  s21::vector<std::unique_ptr<int>> v;
+  for (int i = 0; i < 10; ++i) {
+    v.emplace_back(new int(i));
+  }
+  auto it = v.emplace(v.begin() + 3, std::make_unique<int>(42));
+  EXPECT_EQ(**it, 42);
+  v.insert(v.begin(), std::make_unique<int>(-1));
+  std::unique_ptr<int> last = std::make_unique<int>(100);
+  v.push_back(std::move(last));
+  EXPECT_EQ(last, nullptr);
+  ASSERT_EQ(v.size(), 13U);
+  EXPECT_EQ(*v[0], -1);
+  EXPECT_EQ(*v[4], 42);
+  EXPECT_EQ(*v[5], 3);
+  EXPECT_EQ(*v[12], 100);
+}
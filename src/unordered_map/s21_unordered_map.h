@@ -0,0 +1,235 @@
+#ifndef S21_CONTAINERS_S21_UNORDERED_MAP_UNORDERED_MAP_H_
+#define S21_CONTAINERS_S21_UNORDERED_MAP_UNORDERED_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+
+#include "../hashtable/s21_hashtable.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_map {
+  using table_type =
+      hashtable::HashTable<hashtable::MapPolicy<Key, T>, Hash, KeyEqual>;
+  using table_iterator = typename table_type::Iterator;
+
+  template <typename H, typename E>
+  using if_transparent =
+      std::void_t<typename H::is_transparent, typename E::is_transparent>;
+
+ public:
+  class UnorderedMapIterator;
+  class UnorderedMapConstIterator;
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = UnorderedMapIterator;
+  using const_iterator = UnorderedMapConstIterator;
+  using size_type = size_t;
+
+  // unordered_map member functions
+  unordered_map() noexcept : table() {}
+  explicit unordered_map(size_type bucket_count, const Hash &hash = Hash(),
+                         const KeyEqual &eq = KeyEqual())
+      : table(bucket_count, hash, eq) {}
+  unordered_map(std::initializer_list<value_type> const &items) {
+    table.reserve(items.size());
+    for (const_reference item : items) {
+      insert(item);
+    }
+  }
+  unordered_map(const unordered_map &m) = default;
+  unordered_map(unordered_map &&m) noexcept = default;
+  ~unordered_map() noexcept = default;
+  unordered_map &operator=(const unordered_map &m) = default;
+  unordered_map &operator=(unordered_map &&m) noexcept = default;
+
+  // unordered_map element access
+  T &at(const Key &key) {
+    iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("No key in the unordered_map");
+    }
+    return (*it).second;
+  }
+  const T &at(const Key &key) const {
+    const_iterator it = find(key);
+    if (it == end()) {
+      throw std::out_of_range("No key in the unordered_map");
+    }
+    return (*it).second;
+  }
+  T &operator[](const Key &key) { return (*try_emplace(key).first).second; }
+  T &operator[](Key &&key) {
+    return (*try_emplace(std::move(key)).first).second;
+  }
+
+  // unordered_map iterators; entries are handed out as a pair of references
+  // so that the key stays read-only while the table can still move it
+  class UnorderedMapIterator {
+   public:
+    UnorderedMapIterator() noexcept = default;
+    UnorderedMapIterator(table_iterator it) noexcept : it_(it) {}
+    std::pair<const key_type &, mapped_type &> operator*() const noexcept {
+      return std::pair<const key_type &, mapped_type &>(it_->first,
+                                                        it_->second);
+    }
+    UnorderedMapIterator &operator++() noexcept {
+      ++it_;
+      return *this;
+    }
+    UnorderedMapIterator operator++(int) noexcept {
+      UnorderedMapIterator it(*this);
+      ++it_;
+      return it;
+    }
+    bool operator==(const UnorderedMapIterator &other) const noexcept {
+      return it_ == other.it_;
+    }
+    bool operator!=(const UnorderedMapIterator &other) const noexcept {
+      return it_ != other.it_;
+    }
+
+   private:
+    friend class unordered_map;
+    table_iterator it_;
+  };
+  class UnorderedMapConstIterator {
+   public:
+    UnorderedMapConstIterator() noexcept = default;
+    UnorderedMapConstIterator(table_iterator it) noexcept : it_(it) {}
+    UnorderedMapConstIterator(const UnorderedMapIterator &other) noexcept
+        : it_(other.it_) {}
+    std::pair<const key_type &, const mapped_type &> operator*()
+        const noexcept {
+      return std::pair<const key_type &, const mapped_type &>(it_->first,
+                                                              it_->second);
+    }
+    UnorderedMapConstIterator &operator++() noexcept {
+      ++it_;
+      return *this;
+    }
+    UnorderedMapConstIterator operator++(int) noexcept {
+      UnorderedMapConstIterator it(*this);
+      ++it_;
+      return it;
+    }
+    bool operator==(const UnorderedMapConstIterator &other) const noexcept {
+      return it_ == other.it_;
+    }
+    bool operator!=(const UnorderedMapConstIterator &other) const noexcept {
+      return it_ != other.it_;
+    }
+
+   private:
+    table_iterator it_;
+  };
+
+  iterator begin() noexcept { return table.begin(); }
+  iterator end() noexcept { return table.end(); }
+  const_iterator begin() const noexcept { return table.begin(); }
+  const_iterator end() const noexcept { return table.end(); }
+
+  // unordered_map capacity
+  bool empty() const noexcept { return table.size() == 0; }
+  size_type size() const noexcept { return table.size(); }
+  size_type max_size() const noexcept { return table.max_size(); }
+
+  // unordered_map modifiers
+  void clear() noexcept { table.clear(); }
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return try_emplace(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return try_emplace(key, obj);
+  }
+  std::pair<iterator, bool> insert(Key &&key, T &&obj) {
+    return try_emplace(std::move(key), std::move(obj));
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    std::pair<iterator, bool> p = try_emplace(key, obj);
+    if (!p.second) (*p.first).second = obj;
+    return p;
+  }
+  // builds the pair first, the key is needed before a slot can be chosen
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    std::pair<key_type, mapped_type> value(std::forward<Args>(args)...);
+    return table.try_emplace(value.first, std::move(value));
+  }
+  // leaves args untouched when the key is already present
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key &key, Args &&...args) {
+    return table.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args) {
+    return table.try_emplace(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  void erase(iterator pos) { table.erase(pos.it_); }
+  void erase(const key_type &key) { table.erase(key); }
+  void swap(unordered_map &other) noexcept { table.swap(other.table); }
+  // moves over the entries of other whose keys are not present yet
+  void merge(unordered_map &other) { table.merge(other.table); }
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+
+    res.reserve(sizeof...(args));
+    table.reserve(size() + sizeof...(args));
+    (res.push_back(emplace(std::forward<Args>(args))), ...);
+    return res;
+  }
+
+  // unordered_map lookup
+  iterator find(const key_type &key) { return table.find(key); }
+  const_iterator find(const key_type &key) const { return table.find(key); }
+  // heterogeneous lookup, available when Hash and KeyEqual are transparent
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = if_transparent<H, E>>
+  iterator find(const K &key) {
+    return table.find(key);
+  }
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = if_transparent<H, E>>
+  const_iterator find(const K &key) const {
+    return table.find(key);
+  }
+  bool contains(const key_type &key) const {
+    return table.find(key) != table.end();
+  }
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = if_transparent<H, E>>
+  bool contains(const K &key) const {
+    return table.find(key) != table.end();
+  }
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  // unordered_map hash policy
+  size_type bucket_count() const noexcept { return table.bucket_count(); }
+  float load_factor() const noexcept { return table.load_factor(); }
+  float max_load_factor() const noexcept { return table.max_load_factor(); }
+  void max_load_factor(float ml) { table.max_load_factor(ml); }
+  void reserve(size_type count) { table.reserve(count); }
+  void rehash(size_type count) { table.rehash(count); }
+  hasher hash_function() const { return table.hash_function(); }
+  key_equal key_eq() const { return table.key_eq(); }
+
+ private:
+  table_type table;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_UNORDERED_MAP_UNORDERED_MAP_H_
@@ -0,0 +1,145 @@
+#ifndef S21_CONTAINERS_S21_UNORDERED_SET_UNORDERED_SET_H_
+#define S21_CONTAINERS_S21_UNORDERED_SET_UNORDERED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+
+#include "../hashtable/s21_hashtable.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_set {
+  using table_type =
+      hashtable::HashTable<hashtable::SetPolicy<Key>, Hash, KeyEqual>;
+  using table_iterator = typename table_type::Iterator;
+
+  template <typename H, typename E>
+  using if_transparent =
+      std::void_t<typename H::is_transparent, typename E::is_transparent>;
+
+ public:
+  class UnorderedSetIterator;
+  using key_type = Key;
+  using value_type = Key;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = UnorderedSetIterator;
+  using const_iterator = UnorderedSetIterator;
+  using size_type = size_t;
+
+  // unordered_set member functions
+  unordered_set() noexcept : table() {}
+  explicit unordered_set(size_type bucket_count, const Hash &hash = Hash(),
+                         const KeyEqual &eq = KeyEqual())
+      : table(bucket_count, hash, eq) {}
+  unordered_set(std::initializer_list<value_type> const &items) {
+    table.reserve(items.size());
+    for (const_reference item : items) {
+      insert(item);
+    }
+  }
+  unordered_set(const unordered_set &s) = default;
+  unordered_set(unordered_set &&s) noexcept = default;
+  ~unordered_set() noexcept = default;
+  unordered_set &operator=(const unordered_set &s) = default;
+  unordered_set &operator=(unordered_set &&s) noexcept = default;
+
+  // unordered_set iterators
+  class UnorderedSetIterator {
+   public:
+    UnorderedSetIterator() noexcept = default;
+    UnorderedSetIterator(table_iterator it) noexcept : it_(it) {}
+    const_reference operator*() const noexcept { return *it_; }
+    const value_type *operator->() const noexcept { return &*it_; }
+    UnorderedSetIterator &operator++() noexcept {
+      ++it_;
+      return *this;
+    }
+    UnorderedSetIterator operator++(int) noexcept {
+      UnorderedSetIterator it(*this);
+      ++it_;
+      return it;
+    }
+    bool operator==(const UnorderedSetIterator &other) const noexcept {
+      return it_ == other.it_;
+    }
+    bool operator!=(const UnorderedSetIterator &other) const noexcept {
+      return it_ != other.it_;
+    }
+
+   private:
+    friend class unordered_set;
+    table_iterator it_;
+  };
+
+  iterator begin() const noexcept { return table.begin(); }
+  iterator end() const noexcept { return table.end(); }
+
+  // unordered_set capacity
+  bool empty() const noexcept { return table.size() == 0; }
+  size_type size() const noexcept { return table.size(); }
+  size_type max_size() const noexcept { return table.max_size(); }
+
+  // unordered_set modifiers
+  void clear() noexcept { table.clear(); }
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return table.try_emplace(value, value);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return table.try_emplace(value, std::move(value));
+  }
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return insert(value_type(std::forward<Args>(args)...));
+  }
+  void erase(iterator pos) { table.erase(pos.it_); }
+  void erase(const key_type &key) { table.erase(key); }
+  void swap(unordered_set &other) noexcept { table.swap(other.table); }
+  // moves over the elements of other that are not present yet
+  void merge(unordered_set &other) { table.merge(other.table); }
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    vector<std::pair<iterator, bool>> res;
+
+    res.reserve(sizeof...(args));
+    table.reserve(size() + sizeof...(args));
+    (res.push_back(insert(std::forward<Args>(args))), ...);
+    return res;
+  }
+
+  // unordered_set lookup
+  iterator find(const key_type &key) const { return table.find(key); }
+  // heterogeneous lookup, available when Hash and KeyEqual are transparent
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = if_transparent<H, E>>
+  iterator find(const K &key) const {
+    return table.find(key);
+  }
+  bool contains(const key_type &key) const { return find(key) != end(); }
+  template <typename K, typename H = Hash, typename E = KeyEqual,
+            typename = if_transparent<H, E>>
+  bool contains(const K &key) const {
+    return table.find(key) != table.end();
+  }
+  size_type count(const key_type &key) const { return contains(key) ? 1 : 0; }
+
+  // unordered_set hash policy
+  size_type bucket_count() const noexcept { return table.bucket_count(); }
+  float load_factor() const noexcept { return table.load_factor(); }
+  float max_load_factor() const noexcept { return table.max_load_factor(); }
+  void max_load_factor(float ml) { table.max_load_factor(ml); }
+  void reserve(size_type count) { table.reserve(count); }
+  void rehash(size_type count) { table.rehash(count); }
+  hasher hash_function() const { return table.hash_function(); }
+  key_equal key_eq() const { return table.key_eq(); }
+
+ private:
+  table_type table;
+};
+}  // namespace s21
+
+#endif  // S21_CONTAINERS_S21_UNORDERED_SET_UNORDERED_SET_H_
@@ -1,17 +1,23 @@
 #ifndef S21_CONTAINERS_S21_VECTOR_VECTOR_H_
 #define S21_CONTAINERS_S21_VECTOR_VECTOR_H_
 
+#include <algorithm>
 #include <climits>
 #include <cstring>
 #include <initializer_list>
+#include <memory>
 #include <stdexcept>
+#include <utility>
+
+#include "../memory/s21_memory.h"
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Allocator = std::allocator<T>>
 class vector {
  public:
   // vector member type
   using value_type = T;
+  using allocator_type = Allocator;
   using reference = T &;
   using const_reference = const T &;
   using iterator = T *;
@@ -19,32 +25,56 @@ class vector {
   using size_type = size_t;
 
   // vector member functions
-  vector() noexcept : start(nullptr), finish(nullptr), allocd(0) {}
-  explicit vector(size_type n) {
-    start = new value_type[n]();
+  vector() noexcept(noexcept(Allocator()))
+      : start(nullptr), finish(nullptr), allocd(0), alloc() {}
+  explicit vector(const Allocator &a) noexcept
+      : start(nullptr), finish(nullptr), allocd(0), alloc(a) {}
+  explicit vector(size_type n, const Allocator &a = Allocator())
+      : vector(a) {
+    start = allocate(n);
     allocd = n;
-    finish = start + n;
+    finish = start;
+    try {
+      for (; finish != start + n; ++finish) {
+        alloc_traits::construct(alloc, finish);
+      }
+    } catch (...) {
+      free_storage();
+      throw;
+    }
   }
-  vector(std::initializer_list<value_type> const &items) : vector() {
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &a = Allocator())
+      : vector(a) {
     reserve(items.size());
-    for (auto it : items) {
-      push_back(it);
+    for (auto &item : items) {
+      push_back(item);
     }
   }
-  vector(const vector &v) : vector() { *this = v; }
-  vector(vector &&v) noexcept : vector() { *this = std::move(v); }
-  ~vector() noexcept { delete[] start; }
+  vector(const vector &v)
+      : vector(alloc_traits::select_on_container_copy_construction(v.alloc)) {
+    *this = v;
+  }
+  vector(vector &&v) noexcept
+      : start(v.start),
+        finish(v.finish),
+        allocd(v.allocd),
+        alloc(std::move(v.alloc)) {
+    v.null();
+  }
+  ~vector() noexcept { free_storage(); }
   vector &operator=(const vector &v) {
-    if (this != &v && !v.empty()) {
-      reserve(v.size());
-      copy_contents(start, v.start, v.size());
-      finish += v.size();
+    if (this != &v) {
+      clear();
+      if (allocd < v.size()) reserve(v.size());
+      finish = memory::uninitialized_copy(alloc, v.start, v.size(), start);
     }
     return *this;
   }
   vector &operator=(vector &&v) noexcept {
     if (this != &v) {
-      delete[] start;
+      free_storage();
+      alloc = std::move(v.alloc);
       start = v.start;
       finish = v.finish;
       allocd = v.allocd;
@@ -52,6 +82,7 @@ class vector {
     }
     return *this;
   }
+  allocator_type get_allocator() const noexcept { return alloc; }
 
   // vector element access
   reference at(size_type pos) const {
@@ -76,12 +107,15 @@ class vector {
   size_type max_size() const noexcept { return LONG_MAX / sizeof(value_type); }
   void reserve(size_type size) {
     if (size >= this->size() && size != allocd) {
+      iterator new_v = allocate(size);
       size_type old_size = this->size();
-      iterator new_v = new value_type[size];
-      if (!empty()) {
-        copy_contents(new_v, start, old_size);
+      try {
+        memory::relocate(alloc, start, old_size, new_v);
+      } catch (...) {
+        if (new_v != nullptr) alloc_traits::deallocate(alloc, new_v, size);
+        throw;
       }
-      delete[] start;
+      deallocate();
       start = new_v;
       allocd = size;
       finish = start + old_size;
@@ -91,88 +125,119 @@ class vector {
   void shrink_to_fit() { reserve(size()); }
 
   // vector modifiers
-  void clear() noexcept { finish = start; }
+  void clear() noexcept {
+    memory::destroy(alloc, start, finish);
+    finish = start;
+  }
   iterator insert(iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+  iterator insert(iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
     size_type offset = pos - start;
-    push_back(value_type());
-    for (iterator p = finish - 2; p >= start + offset; --p) {
-      p[1] = p[0];
+    if (finish == start + allocd) {
+      grow_and_construct(offset, std::forward<Args>(args)...);
+    } else {
+      memory::emplace_shift(alloc, start + offset, finish,
+                            std::forward<Args>(args)...);
     }
-    start[offset] = value;
     return start + offset;
   }
   void erase(iterator pos) noexcept {
-    for (iterator p = pos; p < finish - 1; ++p) {
-      p[0] = p[1];
-    }
-    pop_back();
+    memory::erase_shift(alloc, pos, finish);
+    --finish;
   }
-  void push_back(const_reference value) {
-    if (allocd == size()) {
-      reserve_push_back();
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (finish == start + allocd) {
+      grow_and_construct(size(), std::forward<Args>(args)...);
+    } else {
+      alloc_traits::construct(alloc, finish, std::forward<Args>(args)...);
+      ++finish;
     }
-    finish[0] = value;
-    ++finish;
+    return finish[-1];
   }
   void pop_back() noexcept {
     if (!empty()) {
       --finish;
+      alloc_traits::destroy(alloc, finish);
     }
   }
   void swap(vector &other) noexcept {
-    iterator temp = start;
-    start = other.start;
-    other.start = temp;
-    temp = finish;
-    finish = other.finish;
-    other.finish = temp;
-    size_t tempsize = allocd;
-    allocd = other.allocd;
-    other.allocd = tempsize;
+    std::swap(start, other.start);
+    std::swap(finish, other.finish);
+    std::swap(allocd, other.allocd);
+    std::swap(alloc, other.alloc);
   }
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args) {
     size_t offset = pos - start;
-    reserve(size() + sizeof...(args));
-    iterator it = start + offset;
-    size_t i = 0;
-    for (auto &&arg : {args...}) {
-      insert(it + i, arg);
-      ++i;
-    }
-    return it;
+    memory::pending_values<Allocator, value_type, sizeof...(Args)> values(
+        alloc, std::forward<Args>(args)...);
+    if (allocd < size() + sizeof...(args)) reserve(size() + sizeof...(args));
+    values.insert_at(start + offset, finish);
+    return start + offset;
   }
   template <typename... Args>
   void insert_many_back(Args &&...args) {
-    reserve(size() + sizeof...(args));
-    for (auto &&arg : {args...}) {
-      push_back(arg);
-    }
+    insert_many(finish, std::forward<Args>(args)...);
   }
 
  private:
+  using alloc_traits = std::allocator_traits<Allocator>;
+
   iterator start;
   iterator finish;
   size_type allocd;
+  allocator_type alloc;
 
   void null() noexcept {
     start = nullptr;
     finish = nullptr;
     allocd = 0;
   }
-  void reserve_push_back() {
+  iterator allocate(size_type count) {
+    return count == 0 ? nullptr : alloc_traits::allocate(alloc, count);
+  }
+  void deallocate() noexcept {
+    if (start != nullptr) alloc_traits::deallocate(alloc, start, allocd);
+  }
+  void free_storage() noexcept {
+    memory::destroy(alloc, start, finish);
+    deallocate();
+    null();
+  }
+  size_type next_capacity() const noexcept {
     if (allocd == 0) {
-      reserve(1);
+      return 1;
     } else if (allocd == 1) {
-      reserve(2);
-    } else {
-      reserve(size() + size() / 2);
+      return 2;
     }
+    return size() + size() / 2;
   }
-  void copy_contents(iterator dest, iterator src, size_type count) noexcept {
-    for (size_type i = 0; i < count; ++i) {
-      dest[i] = src[i];
+  // Builds the new element straight into fresh storage before the old
+  // elements are moved over, so args may still refer into the old buffer.
+  template <typename... Args>
+  void grow_and_construct(size_type offset, Args &&...args) {
+    size_type new_allocd = next_capacity();
+    size_type old_size = size();
+    iterator new_v = allocate(new_allocd);
+    try {
+      memory::construct_and_relocate(alloc, start, old_size, offset, new_v,
+                                     std::forward<Args>(args)...);
+    } catch (...) {
+      alloc_traits::deallocate(alloc, new_v, new_allocd);
+      throw;
     }
+    deallocate();
+    start = new_v;
+    allocd = new_allocd;
+    finish = start + old_size + 1;
   }
 };
 }  // namespace s21